@@ -0,0 +1,46 @@
+#include <cstdio>
+
+#include "../list/s21_list.h"
+#include "s21_bench.h"
+
+// Repeatedly reassigns a List<int> from sources of alternating length, the
+// way a cached result list gets refreshed.
+int main(int argc, char **argv) {
+  const size_t size = s21::bench::Arg_size(argc, argv, 100000);
+  constexpr size_t kRounds = 200;
+  s21::List<int> small;
+  s21::List<int> large;
+  for (size_t i = 0; i < size; ++i) {
+    large.Push_back(static_cast<int>(i));
+    if (i % 2 == 0) small.Push_back(static_cast<int>(i));
+  }
+  std::printf("List<int> reassignment, sources of %zu and %zu elements\n",
+              small.Size(), large.Size());
+
+  s21::List<int> target;
+  // What callers had to write before List had a copy assignment operator.
+  double ms = s21::bench::Time_ms([&] {
+    for (size_t round = 0; round < kRounds; ++round) {
+      target = s21::List<int>(round % 2 ? small : large);
+      s21::bench::Do_not_optimize(target.Back());
+    }
+  });
+  s21::bench::Report("copy construct + move assign", ms, kRounds * size);
+
+  ms = s21::bench::Time_ms([&] {
+    for (size_t round = 0; round < kRounds; ++round) {
+      target = round % 2 ? small : large;
+      s21::bench::Do_not_optimize(target.Back());
+    }
+  });
+  s21::bench::Report("copy assign (node reuse)", ms, kRounds * size);
+
+  ms = s21::bench::Time_ms([&] {
+    for (size_t round = 0; round < kRounds; ++round) {
+      target = large;
+      s21::bench::Do_not_optimize(target.Back());
+    }
+  });
+  s21::bench::Report("copy assign, same length", ms, kRounds * size);
+  return 0;
+}
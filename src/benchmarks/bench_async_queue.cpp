@@ -0,0 +1,92 @@
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../queue/s21_async_queue.h"
+#include "s21_bench.h"
+
+// Baseline consumer side: an s21::Queue guarded by a mutex, with consumers
+// parked on a condition variable.
+class BlockingQueue {
+ public:
+  void Push(int value) {
+    {
+      std::lock_guard<std::mutex> guard(lock_);
+      queue_.Push(value);
+    }
+    ready_.notify_one();
+  }
+  int Pop() {
+    std::unique_lock<std::mutex> guard(lock_);
+    ready_.wait(guard, [this] { return !queue_.Empty(); });
+    int value = queue_.Front();
+    queue_.Pop();
+    return value;
+  }
+
+ private:
+  std::mutex lock_;
+  std::condition_variable ready_;
+  s21::Queue<int> queue_;
+};
+
+s21::Task Bounce(s21::AsyncQueue<int> &in, s21::AsyncQueue<int> &out,
+                 size_t rounds) {
+  for (size_t i = 0; i < rounds; ++i) out.Push(co_await in.Pop() + 1);
+}
+
+s21::Task Consume(s21::AsyncQueue<int> &queue, std::atomic<size_t> &done) {
+  s21::bench::Do_not_optimize(co_await queue.Pop());
+  done.fetch_add(1, std::memory_order_relaxed);
+}
+
+int main(int argc, char **argv) {
+  const size_t rounds = s21::bench::Arg_size(argc, argv, 200000);
+
+  // Ping-pong: every handoff is one consumer going to sleep and another
+  // being woken up, i.e. one context switch.
+  double ms = s21::bench::Time_ms([&] {
+    BlockingQueue ping, pong;
+    std::thread peer([&] {
+      for (size_t i = 0; i < rounds; ++i) pong.Push(ping.Pop() + 1);
+    });
+    int value = 0;
+    for (size_t i = 0; i < rounds; ++i) {
+      ping.Push(value);
+      value = pong.Pop();
+    }
+    peer.join();
+    s21::bench::Do_not_optimize(value);
+  });
+  s21::bench::Report("ping-pong, threads + condition variable", ms,
+                     2 * rounds);
+
+  ms = s21::bench::Time_ms([&] {
+    s21::SingleThreadExecutor executor;
+    s21::AsyncQueue<int> ping(executor), pong(executor);
+    executor.Spawn(Bounce(ping, pong, rounds));
+    executor.Spawn(Bounce(pong, ping, rounds));
+    ping.Push(0);
+    executor.Run();
+  });
+  s21::bench::Report("ping-pong, coroutines on one thread", ms, 2 * rounds);
+
+  // Fan-out: one waiting consumer per item, far more than threads allow.
+  const size_t consumers = 100000;
+  ms = s21::bench::Time_ms([&] {
+    std::atomic<size_t> done{0};
+    s21::ThreadPoolExecutor executor;
+    s21::AsyncQueue<int> queue(executor);
+    for (size_t i = 0; i < consumers; ++i) {
+      executor.Spawn(Consume(queue, done));
+    }
+    while (queue.Waiting() < consumers) std::this_thread::yield();
+    for (size_t i = 0; i < consumers; ++i) queue.Push(static_cast<int>(i));
+    while (done.load() < consumers) std::this_thread::yield();
+  });
+  s21::bench::Report("100k coroutine consumers, thread pool", ms, consumers);
+  return 0;
+}
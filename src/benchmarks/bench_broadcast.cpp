@@ -0,0 +1,95 @@
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../queue/s21_broadcast_ring.h"
+#include "../queue/s21_queue.h"
+#include "s21_bench.h"
+
+// A 64-byte event, so the per-subscriber copies of the fan-out are visible.
+using Event = std::array<uint64_t, 8>;
+
+struct LockedQueue {
+  std::mutex lock;
+  s21::Queue<Event> queue;
+};
+
+// The pattern being replaced: the producer copies every event into one
+// locked Queue per subscriber.
+static double Fan_out(size_t subscribers, size_t events) {
+  std::vector<LockedQueue> queues(subscribers);
+  return s21::bench::Time_ms([&] {
+    std::vector<std::thread> readers;
+    for (auto &q : queues) {
+      readers.emplace_back([&q, events] {
+        uint64_t sum = 0;
+        for (size_t seen = 0; seen < events;) {
+          std::unique_lock<std::mutex> guard(q.lock);
+          if (q.queue.Empty()) {
+            guard.unlock();
+            std::this_thread::yield();
+            continue;
+          }
+          sum += q.queue.Front()[0];
+          q.queue.Pop();
+          ++seen;
+        }
+        s21::bench::Do_not_optimize(sum);
+      });
+    }
+    Event event{};
+    for (size_t i = 0; i < events; ++i) {
+      event[0] = i;
+      for (auto &q : queues) {
+        std::lock_guard<std::mutex> guard(q.lock);
+        q.queue.Push(event);
+      }
+    }
+    for (auto &reader : readers) reader.join();
+  });
+}
+
+static double Ring(size_t subscribers, size_t events) {
+  constexpr size_t kBatch = 64;
+  s21::BroadcastRing<Event> ring(4096);
+  std::vector<s21::BroadcastRing<Event>::Subscriber> cursors;
+  for (size_t s = 0; s < subscribers; ++s) cursors.push_back(ring.Subscribe());
+  return s21::bench::Time_ms([&] {
+    std::vector<std::thread> readers;
+    for (auto &cursor : cursors) {
+      readers.emplace_back([&cursor, events] {
+        uint64_t sum = 0;
+        for (size_t seen = 0; seen < events;) {
+          size_t n = cursor.Poll([&sum](const Event &e) { sum += e[0]; });
+          if (n == 0) std::this_thread::yield();
+          seen += n;
+        }
+        s21::bench::Do_not_optimize(sum);
+      });
+    }
+    for (size_t i = 0; i < events; i += kBatch) {
+      size_t n = std::min(kBatch, events - i);
+      ring.Publish(n, [i](Event &slot, size_t k) { slot[0] = i + k; });
+    }
+    for (auto &reader : readers) reader.join();
+  });
+}
+
+int main(int argc, char **argv) {
+  const size_t events = s21::bench::Arg_size(argc, argv, 1000000);
+  std::printf("%zu 64-byte events delivered to every subscriber\n", events);
+  for (size_t subscribers : {1, 2, 4, 8, 16}) {
+    char label[64];
+    std::snprintf(label, sizeof(label), "%2zu x locked Queue fan-out",
+                  subscribers);
+    s21::bench::Report(label, Fan_out(subscribers, events), events);
+    std::snprintf(label, sizeof(label), "%2zu subscribers, BroadcastRing",
+                  subscribers);
+    s21::bench::Report(label, Ring(subscribers, events), events);
+  }
+  return 0;
+}
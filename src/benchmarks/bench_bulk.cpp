@@ -0,0 +1,91 @@
+#include <algorithm>
+#include <cstdio>
+#include <list>
+#include <numeric>
+
+#include "../list/s21_list.h"
+#include "s21_bench.h"
+
+template <typename T>
+static void Run(const char *type, size_t n, int repeats) {
+  std::list<T> std_list;
+  s21::ArenaList<T> compacted;
+  compacted.Reserve(n);
+  for (size_t i = 0; i < n; ++i) {
+    const T value = static_cast<T>(i % 1000);
+    std_list.push_back(value);
+    compacted.Push_back(value);
+  }
+  const T missing = static_cast<T>(-1);
+  const size_t ops = n * static_cast<size_t>(repeats);
+  T sink = T();
+  std::printf("-- %s, %zu elements\n", type, n);
+
+  double std_sum = s21::bench::Time_ms([&] {
+    for (int r = 0; r < repeats; ++r) {
+      sink += std::accumulate(std_list.begin(), std_list.end(), T());
+    }
+  });
+  s21::bench::Report("std::accumulate(std::list)", std_sum, ops);
+  double walk_sum = s21::bench::Time_ms([&] {
+    for (int r = 0; r < repeats; ++r) {
+      for (auto it = compacted.Cbegin(); it != compacted.Cend(); ++it) {
+        sink += *it;
+      }
+    }
+  });
+  s21::bench::Report("iterator walk (s21::List, compacted)", walk_sum, ops);
+  double s21_sum = s21::bench::Time_ms([&] {
+    for (int r = 0; r < repeats; ++r) sink += compacted.Sum();
+  });
+  s21::bench::Report("s21::List::Sum (compacted)", s21_sum, ops);
+
+  double std_find = s21::bench::Time_ms([&] {
+    for (int r = 0; r < repeats; ++r) {
+      sink += std::find(std_list.begin(), std_list.end(), missing) ==
+              std_list.end();
+    }
+  });
+  s21::bench::Report("std::find miss (std::list)", std_find, ops);
+  double s21_find = s21::bench::Time_ms([&] {
+    for (int r = 0; r < repeats; ++r) {
+      sink += compacted.Find(missing) == compacted.End();
+    }
+  });
+  s21::bench::Report("s21::List::Find miss (compacted)", s21_find, ops);
+
+  double std_count = s21::bench::Time_ms([&] {
+    for (int r = 0; r < repeats; ++r) {
+      sink += static_cast<T>(
+          std::count(std_list.begin(), std_list.end(), static_cast<T>(7)));
+    }
+  });
+  s21::bench::Report("std::count (std::list)", std_count, ops);
+  double s21_count = s21::bench::Time_ms([&] {
+    for (int r = 0; r < repeats; ++r) {
+      sink += static_cast<T>(compacted.Count(static_cast<T>(7)));
+    }
+  });
+  s21::bench::Report("s21::List::Count (compacted)", s21_count, ops);
+
+  double std_minmax = s21::bench::Time_ms([&] {
+    for (int r = 0; r < repeats; ++r) {
+      sink += *std::max_element(std_list.begin(), std_list.end());
+    }
+  });
+  s21::bench::Report("std::max_element (std::list)", std_minmax, ops);
+  double s21_minmax = s21::bench::Time_ms([&] {
+    for (int r = 0; r < repeats; ++r) sink += compacted.Max();
+  });
+  s21::bench::Report("s21::List::Max (compacted)", s21_minmax, ops);
+  s21::bench::Do_not_optimize(sink);
+}
+
+int main(int argc, char **argv) {
+  const size_t n = s21::bench::Arg_size(argc, argv, 4000000);
+  Run<int>("int, memory resident", n, 10);
+  Run<double>("double, memory resident", n, 10);
+  Run<int>("int, cache resident", 20000, static_cast<int>(n / 10000));
+  Run<double>("double, cache resident", 20000, static_cast<int>(n / 10000));
+  return 0;
+}
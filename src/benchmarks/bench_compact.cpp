@@ -0,0 +1,67 @@
+#include <cstdio>
+#include <random>
+
+#include "../list/s21_list.h"
+#include "s21_bench.h"
+
+// Builds a list whose consecutive nodes come from unrelated allocation
+// streams, the way long Insert/Erase/Splice runs leave it: elements are
+// dealt into many short lists at random and the lists are spliced back.
+static s21::ArenaList<int> Fragmented(size_t n) {
+  constexpr size_t kStreams = 4096;
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<size_t> pick(0, kStreams - 1);
+  s21::ArenaList<int> *streams = new s21::ArenaList<int>[kStreams];
+  for (size_t i = 0; i < n; ++i) streams[pick(rng)].Push_back(1);
+  s21::ArenaList<int> list;
+  for (size_t i = 0; i < kStreams; ++i) list.Splice(list.End(), streams[i]);
+  delete[] streams;
+  return list;
+}
+
+static long long Traverse(const s21::ArenaList<int> &list) {
+  long long sum = 0;
+  for (auto it = list.Cbegin(); it != list.Cend(); ++it) sum += *it;
+  return sum;
+}
+
+int main(int argc, char **argv) {
+  const size_t n = s21::bench::Arg_size(argc, argv, 10000000);
+#ifdef S21_LIST_PREFETCH
+  std::printf("software prefetch: on, %zu elements\n", n);
+#else
+  std::printf("software prefetch: off, %zu elements\n", n);
+#endif
+  s21::ArenaList<int> list = Fragmented(n);
+  long long sum = 0;
+
+  double fragmented = s21::bench::Time_ms([&] { sum += Traverse(list); });
+  s21::bench::Report("traverse fragmented", fragmented, n);
+
+  double compact = s21::bench::Time_ms([&] { list.Compact(); });
+  s21::bench::Report("Compact()", compact, n);
+
+  double compacted = s21::bench::Time_ms([&] { sum += Traverse(list); });
+  s21::bench::Report("traverse compacted", compacted, n);
+  std::printf("speedup: %.1fx\n", fragmented / compacted);
+
+  double sort_time = s21::bench::Time_ms([&] {
+    s21::ArenaList<int> sorted = Fragmented(n / 10);
+    sorted.Sort();
+    sum += sorted.Front();
+  });
+  s21::bench::Report("build fragmented n/10 + Sort", sort_time, n / 10);
+
+  s21::ArenaList<int> reserved;
+  double push = s21::bench::Time_ms([&] {
+    reserved.Reserve(n);
+    for (size_t i = 0; i < n; ++i) reserved.Push_back(1);
+  });
+  s21::bench::Report("Reserve + push_back", push, n);
+  double reserved_walk =
+      s21::bench::Time_ms([&] { sum += Traverse(reserved); });
+  s21::bench::Report("traverse reserved", reserved_walk, n);
+
+  s21::bench::Do_not_optimize(sum);
+  return 0;
+}
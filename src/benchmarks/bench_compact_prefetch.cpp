@@ -0,0 +1,3 @@
+// Same workload as bench_compact.cpp, built with software prefetching.
+#define S21_LIST_PREFETCH
+#include "bench_compact.cpp"
@@ -0,0 +1,87 @@
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <random>
+
+#include "../list/s21_compressed_list.h"
+#include "../list/s21_list.h"
+#include "s21_bench.h"
+
+// Every heap allocation is counted, as in bench_xor_list.
+static size_t g_bytes = 0;
+
+void *operator new(size_t size) {
+  g_bytes += size;
+  if (void *p = std::malloc(size ? size : 1)) return p;
+  throw std::bad_alloc();
+}
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete(void *p, size_t) noexcept { std::free(p); }
+
+template <typename L>
+static void Run(const char *name, size_t count) {
+  std::mt19937_64 rng(1);
+  uint64_t now = 1700000000000000;
+  const size_t bytes = g_bytes;
+  L list;
+  double ms = s21::bench::Time_ms([&] {
+    for (size_t i = 0; i < count; ++i) list.Push_back(now += rng() % 2000);
+  });
+  std::printf("%s: %.2f bytes/element requested\n", name,
+              double(g_bytes - bytes) / double(count));
+  s21::bench::Report("  Push_back", ms, count);
+  ms = s21::bench::Time_ms([&] {
+    uint64_t sum = 0;
+    for (uint64_t v : list) sum += v;
+    s21::bench::Do_not_optimize(sum);
+  });
+  s21::bench::Report("  sequential scan", ms, count);
+  ms = s21::bench::Time_ms([&] {
+    uint64_t sum = 0;
+    while (!list.Empty()) {
+      sum += list.Front();
+      list.Pop_front();
+    }
+    s21::bench::Do_not_optimize(sum);
+  });
+  s21::bench::Report("  Front + Pop_front", ms, count);
+}
+
+int main(int argc, char **argv) {
+  const size_t count = s21::bench::Arg_size(argc, argv, 20000000);
+  std::printf("%zu sorted uint64_t timestamps, gaps under 2000\n", count);
+  Run<s21::List<uint64_t>>("List", count);
+  Run<s21::CompressedList<uint64_t>>("CompressedList", count);
+
+  namespace packed = s21::detail::packed;
+  uint64_t values[packed::kBlock];
+  uint64_t now = 1;
+  for (auto &v : values) v = now += 1999;
+  uint64_t words[packed::Words(64)] = {};
+  const unsigned width = packed::Pack(values, values[0], words);
+  const size_t blocks = count / packed::kBlock;
+  double ms = s21::bench::Time_ms([&] {
+    for (size_t i = 0; i < blocks; ++i) {
+      packed::Unpack_scalar(words, width, values[0], values);
+      s21::bench::Do_not_optimize(values[0]);
+    }
+  });
+  std::printf("block decode at %u bits\n", width);
+  s21::bench::Report("  scalar", ms, blocks * packed::kBlock);
+#ifdef S21_SIMD_X86
+  if (s21::detail::simd::Has_avx2()) {
+    ms = s21::bench::Time_ms([&] {
+      for (size_t i = 0; i < blocks; ++i) {
+        packed::Unpack_avx2(words, width, values[0], values);
+        s21::bench::Do_not_optimize(values[0]);
+      }
+    });
+    s21::bench::Report("  AVX2", ms, blocks * packed::kBlock);
+  }
+#endif
+  return 0;
+}
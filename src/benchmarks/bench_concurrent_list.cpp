@@ -0,0 +1,93 @@
+#include <cstdio>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "../list/s21_concurrent_list.h"
+#include "../list/s21_list.h"
+#include "s21_bench.h"
+
+// 90% lookups, 5% inserts, 5% erases over a key range kept half full.
+constexpr int kKeyRange = 2048;
+
+// Baseline: the pattern the request replaces, one s21::List kept sorted
+// behind a single mutex.
+class LockedList {
+ public:
+  bool Insert(int key) {
+    std::lock_guard<std::mutex> guard(lock_);
+    auto it = list_.Begin();
+    while (it != list_.End() && *it < key) ++it;
+    bool inserted = it == list_.End() || *it != key;
+    if (inserted) list_.Insert(it, key);
+    return inserted;
+  }
+  bool Erase(int key) {
+    std::lock_guard<std::mutex> guard(lock_);
+    auto it = list_.Begin();
+    while (it != list_.End() && *it < key) ++it;
+    bool erased = it != list_.End() && *it == key;
+    if (erased) list_.Erase(it);
+    return erased;
+  }
+  bool Contains(int key) {
+    std::lock_guard<std::mutex> guard(lock_);
+    auto it = list_.Begin();
+    while (it != list_.End() && *it < key) ++it;
+    return it != list_.End() && *it == key;
+  }
+
+ private:
+  std::mutex lock_;
+  s21::List<int> list_;
+};
+
+template <typename Set>
+static double Run(Set &set, unsigned threads, size_t ops_per_thread) {
+  return s21::bench::Time_ms([&] {
+    std::vector<std::thread> workers;
+    for (unsigned t = 0; t < threads; ++t) {
+      workers.emplace_back([&set, t, ops_per_thread] {
+        std::mt19937 rng(t + 1);
+        std::uniform_int_distribution<int> key(0, kKeyRange - 1);
+        std::uniform_int_distribution<int> op(0, 99);
+        size_t hits = 0;
+        for (size_t i = 0; i < ops_per_thread; ++i) {
+          int roll = op(rng);
+          if (roll < 90) {
+            hits += set.Contains(key(rng));
+          } else if (roll < 95) {
+            hits += set.Insert(key(rng));
+          } else {
+            hits += set.Erase(key(rng));
+          }
+        }
+        s21::bench::Do_not_optimize(hits);
+      });
+    }
+    for (auto &worker : workers) worker.join();
+  });
+}
+
+int main(int argc, char **argv) {
+  const size_t ops = s21::bench::Arg_size(argc, argv, 200000);
+  std::printf("90/5/5 read/insert/erase, %d keys, %zu ops per thread\n",
+              kKeyRange, ops);
+  for (unsigned threads : s21::bench::Thread_counts()) {
+    LockedList locked;
+    s21::ConcurrentList<int> concurrent;
+    for (int k = 0; k < kKeyRange; k += 2) {
+      locked.Insert(k);
+      concurrent.Insert(k);
+    }
+    char label[64];
+    std::snprintf(label, sizeof(label), "List + global mutex, %u threads",
+                  threads);
+    s21::bench::Report(label, Run(locked, threads, ops), ops * threads);
+    std::snprintf(label, sizeof(label), "ConcurrentList, %u threads",
+                  threads);
+    s21::bench::Report(label, Run(concurrent, threads, ops), ops * threads);
+  }
+  return 0;
+}
@@ -0,0 +1,67 @@
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <utility>
+
+#include "../queue/s21_delay_queue.h"
+#include "../queue/s21_queue.h"
+#include "s21_bench.h"
+
+using Timer = std::pair<uint64_t, uint32_t>;
+
+int main(int argc, char **argv) {
+  const size_t count = s21::bench::Arg_size(argc, argv, 10000000);
+  constexpr uint64_t kHorizon = uint64_t{1} << 24;
+  constexpr uint64_t kTick = 4096;
+  std::mt19937_64 rng(1);
+
+  // The pattern being replaced: one queue of (deadline, item), every tick
+  // pops everything and pushes back what is not due yet. It is O(pending)
+  // per tick, so it gets a hundredth of the timers and a few ticks.
+  const size_t small = count / 100;
+  const size_t ticks = 16;
+  double ms = s21::bench::Time_ms([&] {
+    s21::Queue<Timer> queue;
+    for (size_t i = 0; i < small; ++i) {
+      queue.Push(Timer(rng() % kHorizon, static_cast<uint32_t>(i)));
+    }
+    size_t fired = 0;
+    for (uint64_t now = kTick; now <= ticks * kTick; now += kTick) {
+      for (size_t n = queue.Size(); n > 0; --n) {
+        Timer timer = queue.Front();
+        queue.Pop();
+        if (timer.first <= now) {
+          ++fired;
+        } else {
+          queue.Push(timer);
+        }
+      }
+    }
+    s21::bench::Do_not_optimize(fired);
+  });
+  std::printf("Queue re-push: %zu timers, %zu ticks\n", small, ticks);
+  s21::bench::Report("  per pending timer per tick", ms, small * ticks);
+
+  s21::DelayQueue<uint32_t> timers;
+  ms = s21::bench::Time_ms([&] {
+    for (size_t i = 0; i < count; ++i) {
+      timers.Schedule(rng() % kHorizon, static_cast<uint32_t>(i));
+    }
+  });
+  std::printf("DelayQueue: %zu timers over %llu ticks\n", count,
+              static_cast<unsigned long long>(kHorizon));
+  s21::bench::Report("  Schedule", ms, count);
+
+  size_t fired = 0;
+  ms = s21::bench::Time_ms([&] {
+    for (uint64_t now = kTick; now <= kHorizon; now += kTick) {
+      s21::List<s21::DelayQueue<uint32_t>::Entry> out;
+      fired += timers.Pop_expired(now, out);
+    }
+  });
+  s21::bench::Report("  Pop_expired, every timer", ms, fired);
+  std::printf("  %zu ticks, %.2f ms per tick\n",
+              static_cast<size_t>(kHorizon / kTick),
+              ms / static_cast<double>(kHorizon / kTick));
+  return 0;
+}
@@ -0,0 +1,71 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#include "../queue/s21_fair_scheduler.h"
+#include "../queue/s21_queue.h"
+#include "s21_bench.h"
+
+// 100k tenants, of which a few are busy at a time.
+int main(int argc, char **argv) {
+  const size_t keys = s21::bench::Arg_size(argc, argv, 100000);
+  const size_t busy = std::max<size_t>(keys / 100, 1);
+  constexpr size_t kPerKey = 200;
+  const size_t total = busy * kPerKey;
+  std::printf("%zu keys, %zu busy with %zu items each\n", keys, busy,
+              kPerKey);
+
+  // The pattern being replaced: round robin over every queue with Empty().
+  std::vector<s21::Queue<int>> queues(keys);
+  for (size_t k = 0; k < busy; ++k) {
+    for (size_t i = 0; i < kPerKey; ++i) queues[k * 100].Push(int(k));
+  }
+  size_t served = 0;
+  double ms = s21::bench::Time_ms([&] {
+    long sum = 0;
+    for (size_t key = 0; served < total; key = (key + 1) % keys) {
+      if (!queues[key].Empty()) {
+        sum += queues[key].Front();
+        queues[key].Pop();
+        ++served;
+      }
+    }
+    s21::bench::Do_not_optimize(sum);
+  });
+  s21::bench::Report("Queue scan with Empty()", ms, total);
+
+  s21::FairScheduler<size_t, int> scheduler;
+  for (size_t key = 0; key < keys; ++key) {
+    scheduler.Set_weight(key, key % 4 + 1);
+  }
+  for (size_t k = 0; k < busy; ++k) {
+    for (size_t i = 0; i < kPerKey; ++i) scheduler.Enqueue(k * 100, int(k));
+  }
+  ms = s21::bench::Time_ms([&] {
+    long sum = 0;
+    while (auto value = scheduler.Dequeue()) sum += *value;
+    s21::bench::Do_not_optimize(sum);
+  });
+  s21::bench::Report("FairScheduler::Dequeue", ms, total);
+
+  // Fairness: with every key backlogged, each key's share of a window
+  // should match its weight.
+  for (size_t key = 0; key < keys; ++key) scheduler.Enqueue(key, int(key));
+  for (size_t key = 0; key < keys; ++key) scheduler.Enqueue(key, int(key));
+  std::vector<size_t> count(keys, 0);
+  const size_t window = keys;
+  ms = s21::bench::Time_ms([&] {
+    for (size_t i = 0; i < window; ++i) ++count[size_t(*scheduler.Dequeue())];
+  });
+  s21::bench::Report("FairScheduler, all keys backlogged", ms, window);
+  double weight_sum = 0;
+  for (size_t key = 0; key < keys; ++key) weight_sum += double(key % 4 + 1);
+  double worst = 0;
+  for (size_t key = 0; key < keys; ++key) {
+    double expected = double(window) * double(key % 4 + 1) / weight_sum;
+    worst = std::max(worst, std::abs(double(count[key]) - expected));
+  }
+  std::printf("  largest deviation from weighted share: %.2f items\n", worst);
+  return 0;
+}
@@ -0,0 +1,56 @@
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "../list/s21_indexed_list.h"
+#include "../list/s21_list.h"
+#include "s21_bench.h"
+
+// Keeps a list sorted while values arrive in random order, then reads the
+// median back.
+int main(int argc, char **argv) {
+  const size_t count = s21::bench::Arg_size(argc, argv, 20000);
+  std::vector<int> values(count);
+  std::mt19937 rng(42);
+  for (auto &value : values) value = static_cast<int>(rng());
+
+  std::printf("sorted insert of %zu random ints\n", count);
+
+  // The pattern the index replaces: append, then Sort() again. It is
+  // quadratic with a large constant, so it only gets the first values.
+  const size_t resorted = std::min<size_t>(count, 2000);
+  double ms = s21::bench::Time_ms([&] {
+    s21::List<int> list;
+    for (size_t i = 0; i < resorted; ++i) {
+      list.Push_back(values[i]);
+      list.Sort();
+    }
+    auto it = list.Begin();
+    for (size_t i = 0; i < list.Size() / 2; ++i) ++it;
+    s21::bench::Do_not_optimize(*it);
+  });
+  s21::bench::Report("List Push_back + Sort (first 2000)", ms, resorted);
+
+  // Linear scan for the insert position: the best List can do without Sort.
+  ms = s21::bench::Time_ms([&] {
+    s21::List<int> list;
+    for (int value : values) {
+      auto it = list.Begin();
+      while (it != list.End() && !(value < *it)) ++it;
+      list.Insert(it, value);
+    }
+    auto it = list.Begin();
+    for (size_t i = 0; i < list.Size() / 2; ++i) ++it;
+    s21::bench::Do_not_optimize(*it);
+  });
+  s21::bench::Report("List scan + Insert", ms, count);
+
+  ms = s21::bench::Time_ms([&] {
+    s21::IndexedList<int> list;
+    for (int value : values) list.Insert_sorted(value);
+    s21::bench::Do_not_optimize(list.At(list.Size() / 2));
+  });
+  s21::bench::Report("IndexedList Insert_sorted", ms, count);
+  return 0;
+}
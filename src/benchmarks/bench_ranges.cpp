@@ -0,0 +1,69 @@
+#include <algorithm>
+#include <cstdio>
+#include <ranges>
+#include <vector>
+
+#include "../list/s21_list.h"
+#include "../queue/s21_queue.h"
+#include "s21_bench.h"
+
+static bool Keep(int v) { return v % 3 == 0; }
+static long Scale(int v) { return long{v} * 7; }
+
+int main(int argc, char **argv) {
+  const size_t count = s21::bench::Arg_size(argc, argv, 5000000);
+  const size_t wanted = count / 10;
+  std::printf("%zu queued ints, keep %zu of those divisible by 3\n", count,
+              wanted);
+
+  // The pattern being replaced: drain into a vector, then one vector per
+  // stage.
+  s21::Queue<int> queue;
+  for (size_t i = 0; i < count; ++i) queue.Push(static_cast<int>(i));
+  size_t copied = 0;
+  double ms = s21::bench::Time_ms([&] {
+    std::vector<int> drained;
+    while (!queue.Empty()) {
+      drained.push_back(queue.Front());
+      queue.Pop();
+    }
+    std::vector<int> kept;
+    std::copy_if(drained.begin(), drained.end(), std::back_inserter(kept),
+                 Keep);
+    std::vector<long> scaled(kept.size());
+    std::transform(kept.begin(), kept.end(), scaled.begin(), Scale);
+    scaled.resize(std::min(scaled.size(), wanted));
+    copied = drained.size() + kept.size() + scaled.size();
+    long sum = 0;
+    for (long v : scaled) sum += v;
+    s21::bench::Do_not_optimize(sum);
+  });
+  s21::bench::Report("drain + vector per stage", ms, count);
+  std::printf("  %zu elements copied into intermediate vectors\n", copied);
+
+  for (size_t i = 0; i < count; ++i) queue.Push(static_cast<int>(i));
+  ms = s21::bench::Time_ms([&] {
+    long sum = 0;
+    for (long v : queue.Drain() | std::views::filter(Keep) |
+                      std::views::transform(Scale) |
+                      std::views::take(wanted)) {
+      sum += v;
+    }
+    s21::bench::Do_not_optimize(sum);
+  });
+  s21::bench::Report("Drain() | filter | transform | take", ms, count);
+  std::printf("  0 copies, %zu elements left queued\n", queue.Size());
+
+  s21::List<int> list;
+  for (size_t i = 0; i < count; ++i) list.Push_back(static_cast<int>(i));
+  ms = s21::bench::Time_ms([&] {
+    std::vector<int> copy(list.Cbegin(), list.Cend());
+    s21::bench::Do_not_optimize(std::count_if(copy.begin(), copy.end(), Keep));
+  });
+  s21::bench::Report("List copied to vector, count_if", ms, count);
+  ms = s21::bench::Time_ms([&] {
+    s21::bench::Do_not_optimize(std::ranges::count_if(list, Keep));
+  });
+  s21::bench::Report("std::ranges::count_if(list)", ms, count);
+  return 0;
+}
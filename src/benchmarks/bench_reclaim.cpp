@@ -0,0 +1,46 @@
+#include <algorithm>
+#include <cstdio>
+
+#include "../list/s21_list.h"
+#include "s21_bench.h"
+
+static void Fill(s21::ArenaList<int> &list, size_t count) {
+  for (size_t i = 0; i < count; ++i) list.Push_back(static_cast<int>(i));
+}
+
+// Time the calling thread spends dropping a large list.
+int main(int argc, char **argv) {
+  const size_t count = s21::bench::Arg_size(argc, argv, 20000000);
+  std::printf("dropping an ArenaList<int> of %zu elements\n", count);
+
+  s21::ArenaList<int> list;
+  Fill(list, count);
+  double ms = s21::bench::Time_ms([&] { list.Clear(); });
+  s21::bench::Report("Clear(), synchronous", ms, count);
+
+  {
+    s21::NodeReclaimer reclaimer;
+    list.Set_reclaimer(&reclaimer);
+    Fill(list, count);
+    ms = s21::bench::Time_ms([&] { list.Clear(); });
+    s21::bench::Report("Clear(), deferred: caller stall", ms, count);
+    ms = s21::bench::Time_ms([&] { reclaimer.Drain(); });
+    s21::bench::Report("  background work still pending", ms, count);
+    list.Set_reclaimer(nullptr);
+  }
+
+  constexpr size_t kBudget = 65536;
+  Fill(list, count);
+  double worst = 0;
+  ms = s21::bench::Time_ms([&] {
+    bool more = true;
+    while (more) {
+      worst = std::max(worst, s21::bench::Time_ms([&] {
+                         more = list.Clear_incremental(kBudget) > 0;
+                       }));
+    }
+  });
+  s21::bench::Report("Clear_incremental(65536), total", ms, count);
+  std::printf("%-44s %10.2f ms\n", "  longest single step", worst);
+  return 0;
+}
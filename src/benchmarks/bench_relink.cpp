@@ -0,0 +1,75 @@
+#include <cstdio>
+#include <iterator>
+
+#include "../list/s21_list.h"
+#include "s21_bench.h"
+
+// Same node layout for every run, so the timings compare the algorithms
+// rather than how scattered the previous run left the heap.
+static void Fill(s21::ArenaList<int> &list, size_t count) {
+  list.Clear();
+  list.Reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    list.Push_back(static_cast<int>((i * 2654435761u) % count));
+  }
+}
+
+static bool Small(int v) { return v % 4 == 0; }
+
+int main(int argc, char **argv) {
+  const size_t count = s21::bench::Arg_size(argc, argv, 10000000);
+  std::printf("ArenaList<int> of %zu elements\n", count);
+  s21::ArenaList<int> list;
+
+  // The pattern being replaced: copy into two new lists and join them.
+  Fill(list, count);
+  double ms = s21::bench::Time_ms([&] {
+    s21::ArenaList<int> yes;
+    s21::ArenaList<int> no;
+    for (auto it = list.Cbegin(); it != list.Cend(); ++it) {
+      (Small(*it) ? yes : no).Push_back(*it);
+    }
+    yes.Splice(yes.End(), no);
+    list.Swap(yes);
+  });
+  s21::bench::Report("partition by Push_back copies", ms, count);
+
+  Fill(list, count);
+  ms = s21::bench::Time_ms([&] { list.Stable_partition(Small); });
+  s21::bench::Report("Stable_partition", ms, count);
+  for (unsigned threads : s21::bench::Thread_counts()) {
+    Fill(list, count);
+    ms = s21::bench::Time_ms([&] { list.Stable_partition(Small, threads); });
+    char label[64];
+    std::snprintf(label, sizeof(label), "Stable_partition, %u threads",
+                  threads);
+    s21::bench::Report(label, ms, count);
+  }
+
+  Fill(list, count);
+  const size_t half = count / 2;
+  ms = s21::bench::Time_ms([&] {
+    for (size_t i = 0; i < half; ++i) {
+      list.Push_back(list.Front());
+      list.Pop_front();
+    }
+  });
+  s21::bench::Report("rotate by Push_back + Pop_front", ms, half);
+  auto middle = std::next(list.Begin(), static_cast<std::ptrdiff_t>(half));
+  ms = s21::bench::Time_ms([&] { list.Rotate(middle); });
+  s21::bench::Report("Rotate", ms, 1);
+
+  middle = std::next(list.Begin(), static_cast<std::ptrdiff_t>(half));
+  ms = s21::bench::Time_ms([&] {
+    s21::ArenaList<int> tail = list.Split(middle);
+    list.Splice(list.End(), tail);
+  });
+  s21::bench::Report("Split (counts the tail) + Splice back", ms, 1);
+  middle = std::next(list.Begin(), static_cast<std::ptrdiff_t>(half));
+  ms = s21::bench::Time_ms([&] {
+    s21::ArenaList<int> tail = list.Split(middle, count - half);
+    list.Splice(list.End(), tail);
+  });
+  s21::bench::Report("Split with size + Splice back", ms, 1);
+  return 0;
+}
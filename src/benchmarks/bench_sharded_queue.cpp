@@ -0,0 +1,74 @@
+#include <cstdio>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "../queue/s21_queue.h"
+#include "../queue/s21_sharded_queue.h"
+#include "s21_bench.h"
+
+// Baseline: one s21::Queue behind one mutex.
+class LockedQueue {
+ public:
+  void Push(int value) {
+    std::lock_guard<std::mutex> guard(lock_);
+    queue_.Push(value);
+  }
+  std::optional<int> Try_pop() {
+    std::lock_guard<std::mutex> guard(lock_);
+    std::optional<int> value;
+    if (!queue_.Empty()) {
+      value = queue_.Front();
+      queue_.Pop();
+    }
+    return value;
+  }
+
+ private:
+  std::mutex lock_;
+  s21::Queue<int> queue_;
+};
+
+// Every thread pushes a burst, then pops as many elements as it pushed.
+template <typename Q>
+static double Run(Q &queue, unsigned threads, size_t ops_per_thread) {
+  constexpr size_t kBurst = 64;
+  return s21::bench::Time_ms([&] {
+    std::vector<std::thread> workers;
+    for (unsigned t = 0; t < threads; ++t) {
+      workers.emplace_back([&queue, ops_per_thread] {
+        long sum = 0;
+        for (size_t done = 0; done < ops_per_thread; done += kBurst) {
+          for (size_t i = 0; i < kBurst; ++i) {
+            queue.Push(static_cast<int>(i));
+          }
+          for (size_t i = 0; i < kBurst;) {
+            if (auto value = queue.Try_pop()) {
+              sum += *value;
+              ++i;
+            }
+          }
+        }
+        s21::bench::Do_not_optimize(sum);
+      });
+    }
+    for (auto &worker : workers) worker.join();
+  });
+}
+
+int main(int argc, char **argv) {
+  const size_t ops = s21::bench::Arg_size(argc, argv, 1000000);
+  std::printf("push/pop bursts of 64, %zu push+pop pairs per thread\n", ops);
+  for (unsigned threads : s21::bench::Thread_counts()) {
+    LockedQueue locked;
+    s21::ShardedQueue<int> sharded;
+    char label[64];
+    std::snprintf(label, sizeof(label), "Queue + global mutex, %u threads",
+                  threads);
+    s21::bench::Report(label, Run(locked, threads, ops), ops * threads);
+    std::snprintf(label, sizeof(label), "ShardedQueue, %u threads", threads);
+    s21::bench::Report(label, Run(sharded, threads, ops), ops * threads);
+  }
+  return 0;
+}
@@ -0,0 +1,43 @@
+#include <cstdio>
+
+#include "../list/s21_snapshot_list.h"
+#include "../queue/s21_snapshot_queue.h"
+#include "s21_bench.h"
+
+// Cost of one monitoring snapshot of a live queue, by queue length: a deep
+// copy of Queue against SnapshotQueue::Snapshot().
+int main(int argc, char **argv) {
+  const size_t max_size = s21::bench::Arg_size(argc, argv, 1000000);
+  constexpr size_t kRounds = 20;
+  for (size_t size = 1000; size <= max_size; size *= 10) {
+    s21::Queue<int> queue;
+    s21::SnapshotQueue<int> snapshot_queue;
+    for (size_t i = 0; i < size; ++i) {
+      queue.Push(static_cast<int>(i));
+      snapshot_queue.Push(static_cast<int>(i));
+    }
+    char label[64];
+    double ms = s21::bench::Time_ms([&] {
+      for (size_t round = 0; round < kRounds; ++round) {
+        s21::Queue<int> copy(queue);
+        s21::bench::Do_not_optimize(copy.Back());
+        queue.Pop();
+        queue.Push(0);
+      }
+    });
+    std::snprintf(label, sizeof(label), "Queue copy, %zu elements", size);
+    s21::bench::Report(label, ms, kRounds);
+    ms = s21::bench::Time_ms([&] {
+      for (size_t round = 0; round < kRounds; ++round) {
+        auto view = snapshot_queue.Snapshot();
+        s21::bench::Do_not_optimize(view.Back());
+        snapshot_queue.Pop();
+        snapshot_queue.Push(0);
+      }
+    });
+    std::snprintf(label, sizeof(label), "SnapshotQueue::Snapshot, %zu elements",
+                  size);
+    s21::bench::Report(label, ms, kRounds);
+  }
+  return 0;
+}
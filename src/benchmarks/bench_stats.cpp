@@ -0,0 +1,59 @@
+#include <cstdio>
+
+#include "../list/s21_list.h"
+#include "../queue/s21_queue.h"
+#include "s21_bench.h"
+
+// The disabled stats policy must leave both layout and hot paths untouched:
+// NoStats adds no bytes on top of the bare list and runs as fast as the
+// instrumented build minus the counting. The layout is the baseline head,
+// tail and size.
+static_assert(sizeof(s21::List<int>) == 2 * sizeof(void *) + sizeof(size_t));
+static_assert(sizeof(s21::List<int>) + sizeof(s21::CountingStats) ==
+              sizeof(s21::List<int, s21::CountingStats>));
+static_assert(sizeof(s21::Queue<int>) == sizeof(s21::List<int>));
+
+template <typename Policy>
+static void Run(const char *label, size_t n) {
+  double push_pop = s21::bench::Time_ms([n] {
+    s21::List<int, Policy> list;
+    for (size_t i = 0; i < n; ++i) list.Push_back(static_cast<int>(i));
+    while (!list.Empty()) list.Pop_front();
+    s21::bench::Do_not_optimize(list.Stats());
+  });
+  s21::bench::Report(std::string("List push_back+pop_front ") + label,
+                     push_pop, 2 * n);
+
+  double queue = s21::bench::Time_ms([n] {
+    s21::Queue<int, Policy> q;
+    for (size_t i = 0; i < n; ++i) {
+      q.Push(static_cast<int>(i));
+      if (i % 2) q.Pop();
+    }
+    while (!q.Empty()) q.Pop();
+    s21::bench::Do_not_optimize(q.Stats().container.pops);
+  });
+  s21::bench::Report(std::string("Queue push/pop ") + label, queue, 2 * n);
+
+  s21::List<int, Policy> list;
+  for (size_t i = 0; i < n / 10; ++i) list.Push_back(static_cast<int>(n - i));
+  double sort = s21::bench::Time_ms([&list] { list.Sort(); });
+  s21::bench::Report(std::string("List sort n/10 ") + label, sort, n / 10);
+}
+
+int main(int argc, char **argv) {
+  const size_t n = s21::bench::Arg_size(argc, argv, 2000000);
+  std::printf("sizeof List<int>: NoStats %zu, CountingStats %zu\n",
+              sizeof(s21::List<int>),
+              sizeof(s21::List<int, s21::CountingStats>));
+  std::printf("sizeof Queue<int>: NoStats %zu, CountingStats %zu\n",
+              sizeof(s21::Queue<int>),
+              sizeof(s21::Queue<int, s21::CountingStats>));
+  {
+    // Warm the allocator so the first measured run is not penalized.
+    s21::List<int> warmup(n);
+  }
+  Run<s21::NoStats>("[NoStats]", n);
+  Run<s21::CountingStats>("[CountingStats]", n);
+  return 0;
+}
@@ -0,0 +1,81 @@
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+#include "../list/s21_list.h"
+#include "../list/s21_xor_list.h"
+#include "s21_bench.h"
+
+// Every heap allocation in this program is counted, so the footprint below
+// is what the containers asked for (malloc's own headers come on top).
+static size_t g_bytes = 0;
+static size_t g_allocations = 0;
+
+void *operator new(size_t size) {
+  g_bytes += size;
+  ++g_allocations;
+  if (void *p = std::malloc(size ? size : 1)) return p;
+  throw std::bad_alloc();
+}
+// Arena blocks are over-aligned.
+void *operator new(size_t size, std::align_val_t align) {
+  g_bytes += size;
+  ++g_allocations;
+  const size_t alignment = static_cast<size_t>(align);
+  if (void *p = std::aligned_alloc(alignment, (size + alignment - 1) /
+                                                  alignment * alignment)) {
+    return p;
+  }
+  throw std::bad_alloc();
+}
+// GCC flags free() inside a replaced operator delete, which is exactly the
+// pairing the replacement operator new above sets up.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete(void *p, size_t) noexcept { std::free(p); }
+void operator delete(void *p, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void *p, size_t, std::align_val_t) noexcept {
+  std::free(p);
+}
+
+template <typename L>
+static void Run(const char *name, size_t count) {
+  const size_t bytes = g_bytes;
+  const size_t allocations = g_allocations;
+  L list;
+  double ms = s21::bench::Time_ms([&] {
+    for (size_t i = 0; i < count; ++i) list.Push_back(uint32_t(i));
+  });
+  std::printf("%s: %.1f bytes/element requested in %zu allocations\n", name,
+              double(g_bytes - bytes) / double(count),
+              g_allocations - allocations);
+  s21::bench::Report("  Push_back", ms, count);
+  ms = s21::bench::Time_ms([&] {
+    uint64_t sum = 0;
+    for (uint32_t v : list) sum += v;
+    s21::bench::Do_not_optimize(sum);
+  });
+  s21::bench::Report("  iterate", ms, count);
+  ms = s21::bench::Time_ms([&] {
+    for (size_t i = 0; i < count; ++i) {
+      list.Push_front(list.Back());
+      list.Pop_back();
+    }
+  });
+  s21::bench::Report("  rotate (Push_front + Pop_back)", ms, count);
+  ms = s21::bench::Time_ms([&] { list.Reverse(); });
+  s21::bench::Report("  Reverse", ms, count);
+  ms = s21::bench::Time_ms([&] { list.Clear(); });
+  s21::bench::Report("  Clear", ms, count);
+}
+
+int main(int argc, char **argv) {
+  const size_t count = s21::bench::Arg_size(argc, argv, 10000000);
+  std::printf("%zu uint32_t elements\n", count);
+  Run<s21::List<uint32_t>>("List", count);
+  Run<s21::XorList<uint32_t>>("XorList", count);
+  return 0;
+}
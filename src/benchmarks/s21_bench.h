@@ -0,0 +1,52 @@
+#ifndef S21_BENCH_H
+#define S21_BENCH_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace s21 {
+namespace bench {
+// Keeps the optimizer from discarding a computed value.
+template <typename T>
+inline void Do_not_optimize(const T &value) {
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+template <typename F>
+double Time_ms(F &&body) {
+  const auto start = std::chrono::steady_clock::now();
+  body();
+  const auto stop = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+// Element count taken from the first command line argument, so the large
+// default workloads can be shrunk for a quick run.
+inline size_t Arg_size(int argc, char **argv, size_t fallback) {
+  return argc > 1 ? std::strtoull(argv[1], nullptr, 10) : fallback;
+}
+
+// 1, 2, 4, ... up to and including every hardware thread.
+inline std::vector<unsigned> Thread_counts() {
+  const unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+  std::vector<unsigned> counts;
+  for (unsigned threads = 1; threads < cores; threads *= 2) {
+    counts.push_back(threads);
+  }
+  counts.push_back(cores);
+  return counts;
+}
+
+inline void Report(const std::string &name, double ms, size_t ops) {
+  std::printf("%-44s %10.2f ms %10.2f ns/op\n", name.c_str(), ms,
+              ops ? ms * 1e6 / static_cast<double>(ops) : 0.0);
+}
+}  // namespace bench
+}  // namespace s21
+
+#endif
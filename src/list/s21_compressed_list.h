@@ -0,0 +1,492 @@
+#ifndef S21_COMPRESSED_LIST_H
+#define S21_COMPRESSED_LIST_H
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_list_simd.h"
+#include "s21_list_stats.h"
+
+namespace s21 {
+namespace detail {
+namespace packed {
+// Block codec. A block holds kBlock = 128 integers widened to 64 bits. Each
+// value is stored as the zigzag-encoded difference to the value four places
+// earlier (the first four to the block's base), so sorted and nearly sorted
+// data need only a few bits per value. The differences are bit-packed at
+// the block's common width in four interleaved lanes: value i belongs to
+// lane i % 4, and word k of lane l is words[4 * k + l]. Row j of the block
+// (values 4j .. 4j + 3) then sits at the same bit offset in all four lanes,
+// so one AVX2 register decodes a whole row with uniform shifts, and undoing
+// the differences is one vector add per row.
+constexpr size_t kBlock = 128;
+constexpr size_t kLanes = 4;
+constexpr size_t kRows = kBlock / kLanes;
+
+inline uint64_t Zigzag(uint64_t delta) {
+  return (delta << 1) ^
+         static_cast<uint64_t>(static_cast<int64_t>(delta) >> 63);
+}
+inline uint64_t Unzigzag(uint64_t value) {
+  return (value >> 1) ^ (0 - (value & 1));
+}
+inline uint64_t Width_mask(unsigned width) {
+  return width == 64 ? ~uint64_t{0} : (uint64_t{1} << width) - 1;
+}
+// 64-bit words needed for a block packed at `width` bits per value.
+constexpr size_t Words(unsigned width) { return kLanes * ((width + 1) / 2); }
+
+// Packs values[0, kBlock) and returns the width; `words` must have room
+// for Words(64) and start zeroed.
+inline unsigned Pack(const uint64_t *values, uint64_t base, uint64_t *words) {
+  uint64_t deltas[kBlock];
+  uint64_t any = 0;
+  for (size_t i = 0; i < kBlock; ++i) {
+    deltas[i] = Zigzag(values[i] - (i < kLanes ? base : values[i - kLanes]));
+    any |= deltas[i];
+  }
+  const unsigned width = static_cast<unsigned>(std::bit_width(any));
+  for (size_t row = 0; row < kRows && width; ++row) {
+    const size_t offset = row * width;
+    const size_t word = offset / 64;
+    const unsigned shift = offset % 64;
+    for (size_t lane = 0; lane < kLanes; ++lane) {
+      const uint64_t delta = deltas[row * kLanes + lane];
+      words[word * kLanes + lane] |= delta << shift;
+      if (shift + width > 64) {
+        words[(word + 1) * kLanes + lane] |= delta >> (64 - shift);
+      }
+    }
+  }
+  return width;
+}
+
+inline void Unpack_scalar(const uint64_t *words, unsigned width,
+                          uint64_t base, uint64_t *out) {
+  const uint64_t mask = Width_mask(width);
+  uint64_t row_values[kLanes] = {base, base, base, base};
+  for (size_t row = 0; row < kRows; ++row) {
+    const size_t offset = row * width;
+    const size_t word = offset / 64;
+    const unsigned shift = offset % 64;
+    for (size_t lane = 0; lane < kLanes; ++lane) {
+      uint64_t packed = 0;
+      if (width) {
+        packed = words[word * kLanes + lane] >> shift;
+        if (shift + width > 64) {
+          packed |= words[(word + 1) * kLanes + lane] << (64 - shift);
+        }
+      }
+      row_values[lane] += Unzigzag(packed & mask);
+      out[row * kLanes + lane] = row_values[lane];
+    }
+  }
+}
+
+#ifdef S21_SIMD_X86
+__attribute__((target("avx2"))) inline void Unpack_avx2(
+    const uint64_t *words, unsigned width, uint64_t base, uint64_t *out) {
+  const __m256i mask =
+      _mm256_set1_epi64x(static_cast<long long>(Width_mask(width)));
+  const __m256i one = _mm256_set1_epi64x(1);
+  const __m256i zero = _mm256_setzero_si256();
+  __m256i row_values = _mm256_set1_epi64x(static_cast<long long>(base));
+  for (size_t row = 0; row < kRows; ++row) {
+    const size_t offset = row * width;
+    const size_t word = offset / 64;
+    const unsigned shift = offset % 64;
+    __m256i packed = zero;
+    if (width) {
+      // Shift counts of 64 and more yield zero, so shift == 0 needs no
+      // special case below.
+      packed = _mm256_srl_epi64(
+          _mm256_loadu_si256(
+              reinterpret_cast<const __m256i *>(words + word * kLanes)),
+          _mm_cvtsi32_si128(static_cast<int>(shift)));
+      if (shift + width > 64) {
+        packed = _mm256_or_si256(
+            packed,
+            _mm256_sll_epi64(
+                _mm256_loadu_si256(reinterpret_cast<const __m256i *>(
+                    words + (word + 1) * kLanes)),
+                _mm_cvtsi32_si128(static_cast<int>(64 - shift))));
+      }
+      packed = _mm256_and_si256(packed, mask);
+    }
+    const __m256i delta = _mm256_xor_si256(
+        _mm256_srli_epi64(packed, 1),
+        _mm256_sub_epi64(zero, _mm256_and_si256(packed, one)));
+    row_values = _mm256_add_epi64(row_values, delta);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + row * kLanes),
+                        row_values);
+  }
+}
+#endif
+
+inline void Unpack(const uint64_t *words, unsigned width, uint64_t base,
+                   uint64_t *out) {
+#ifdef S21_SIMD_X86
+  if (simd::Has_avx2()) {
+    Unpack_avx2(words, width, base, out);
+    return;
+  }
+#endif
+  Unpack_scalar(words, width, base, out);
+}
+
+// One encoded block and its link, allocated with exactly as many words as
+// its width needs.
+struct Block {
+  Block *next;
+  uint64_t base;
+  unsigned width;
+
+  uint64_t *Words() { return reinterpret_cast<uint64_t *>(this + 1); }
+  const uint64_t *Words() const {
+    return reinterpret_cast<const uint64_t *>(this + 1);
+  }
+  size_t Bytes() const { return sizeof(Block) + packed::Words(width) * 8; }
+
+  static Block *Encode(const uint64_t *values) {
+    uint64_t words[packed::Words(64)] = {};
+    const unsigned width = Pack(values, values[0], words);
+    void *memory = ::operator new(sizeof(Block) + packed::Words(width) * 8);
+    Block *block = ::new (memory) Block{nullptr, values[0], width};
+    std::copy(words, words + packed::Words(width), block->Words());
+    return block;
+  }
+  static void Destroy(Block *block) {
+    block->~Block();
+    ::operator delete(static_cast<void *>(block));
+  }
+  void Decode(uint64_t *out) const { Unpack(Words(), width, base, out); }
+};
+static_assert(sizeof(Block) % alignof(uint64_t) == 0);
+}  // namespace packed
+}  // namespace detail
+
+// FIFO sequence of integers stored in compressed blocks of 128: differences
+// between nearby values are bit-packed (see detail::packed), so sorted or
+// nearly sorted data such as timestamps and offsets take a few bits per
+// element instead of a whole list node. Pushes collect in a plain tail
+// buffer that is encoded once it fills up; the head block is decoded into
+// a plain buffer when popping reaches it, so Front, Back, Push_back and
+// Pop_front are O(1) and the structure works as a Queue backend (see
+// CompressedQueue in queue/s21_compressed_queue.h). Iteration is forward
+// only and read only, decoding one block at a time.
+template <typename T, typename StatsPolicy = NoStats>
+class CompressedList {
+  static_assert(std::is_integral_v<T> && !std::is_same_v<T, bool> &&
+                    sizeof(T) <= 8,
+                "CompressedList stores integers of up to 64 bits");
+  using Block = detail::packed::Block;
+  static constexpr size_t kBlock = detail::packed::kBlock;
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+
+  class ConstIterator {
+   public:
+    using value_type = T;
+    using reference = const T &;
+    using pointer = const T *;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::forward_iterator_tag;
+
+    ConstIterator() = default;
+    reference operator*() const { return Data()[pos_]; }
+    pointer operator->() const { return Data() + pos_; }
+    ConstIterator &operator++() {
+      if (++pos_ == end_) Next_segment();
+      return *this;
+    }
+    ConstIterator operator++(int) {
+      ConstIterator tmp = *this;
+      ++*this;
+      return tmp;
+    }
+    bool operator==(const ConstIterator &other) const {
+      return stage_ == other.stage_ && block_ == other.block_ &&
+             pos_ == other.pos_;
+    }
+
+   private:
+    friend class CompressedList;
+    // The parts of the list in iteration order.
+    enum class Stage { kHead, kBlocks, kTail, kEnd };
+
+    explicit ConstIterator(const CompressedList *list)
+        : list_(list), stage_(Stage::kHead) {
+      data_ = list->head_.get();
+      pos_ = list->head_begin_;
+      end_ = list->head_end_;
+      if (pos_ == end_) Next_segment();
+    }
+
+    const T *Data() const {
+      return stage_ == Stage::kBlocks ? buffer_.get() : data_;
+    }
+
+    void Next_segment() {
+      do {
+        pos_ = end_ = 0;
+        data_ = nullptr;
+        if (stage_ == Stage::kHead) {
+          stage_ = Stage::kBlocks;
+          block_ = list_->first_;
+        } else if (stage_ == Stage::kBlocks) {
+          block_ = block_->next;
+        }
+        if (stage_ == Stage::kBlocks && block_) {
+          // Copies of this iterator may still read the current buffer.
+          if (!buffer_ || buffer_.use_count() > 1) {
+            buffer_.reset(new T[kBlock]);
+          }
+          list_->Decode(block_, buffer_.get());
+          end_ = kBlock;
+        } else if (stage_ == Stage::kBlocks) {
+          stage_ = Stage::kTail;
+          data_ = list_->tail_.get();
+          pos_ = list_->tail_begin_;
+          end_ = list_->tail_end_;
+        } else {
+          stage_ = Stage::kEnd;
+        }
+      } while (stage_ != Stage::kEnd && pos_ == end_);
+    }
+
+    const CompressedList *list_ = nullptr;
+    Stage stage_ = Stage::kEnd;
+    const Block *block_ = nullptr;
+    const T *data_ = nullptr;
+    size_type pos_ = 0;
+    size_type end_ = 0;
+    // Decoded block, shared by copies until one of them moves on.
+    std::shared_ptr<T[]> buffer_;
+  };
+  using const_iterator = ConstIterator;
+
+  CompressedList() = default;
+  CompressedList(std::initializer_list<value_type> const &items) {
+    for (const auto &item : items) Push_back(item);
+  }
+  CompressedList(const CompressedList &l) {
+    for (const auto &item : l) Push_back(item);
+  }
+  CompressedList(CompressedList &&l) noexcept { Swap(l); }
+  ~CompressedList() { Clear(); }
+  CompressedList &operator=(const CompressedList &l) {
+    if (this != &l) {
+      CompressedList copy(l);
+      Swap(copy);
+    }
+    return *this;
+  }
+  CompressedList &operator=(CompressedList &&l) noexcept {
+    if (this != &l) {
+      Clear();
+      Swap(l);
+    }
+    return *this;
+  }
+
+  const_reference Front() const {
+    if (Empty()) throw std::out_of_range("List is empty");
+    return head_begin_ < head_end_ ? head_[head_begin_] : tail_[tail_begin_];
+  }
+  const_reference Back() const {
+    if (Empty()) throw std::out_of_range("List is empty");
+    return back_;
+  }
+
+  const_iterator Begin() const { return Cbegin(); }
+  const_iterator End() const { return Cend(); }
+  const_iterator Cbegin() const { return const_iterator(this); }
+  const_iterator Cend() const { return const_iterator(); }
+  const_iterator begin() const { return Cbegin(); }
+  const_iterator end() const { return Cend(); }
+
+  bool Empty() const { return size_ == 0; }
+  size_type Size() const { return size_; }
+  size_type size() const { return size_; }
+
+  // Bytes held: encoded blocks plus the two plain buffers.
+  size_type Bytes_used() const {
+    return block_bytes_ + (head_ ? kBlock * sizeof(T) : 0) +
+           (tail_ ? kBlock * sizeof(T) : 0);
+  }
+
+  void Clear() {
+    while (first_) {
+      Block *next = first_->next;
+      Block::Destroy(first_);
+      stats_.On_free();
+      first_ = next;
+    }
+    last_ = nullptr;
+    head_.reset();
+    tail_.reset();
+    head_begin_ = head_end_ = tail_begin_ = tail_end_ = 0;
+    block_bytes_ = size_ = 0;
+  }
+
+  void Push_back(const_reference value) {
+    if (!tail_) tail_ = std::make_unique<T[]>(kBlock);
+    if (tail_end_ == kBlock) Flush_tail();
+    tail_[tail_end_++] = value;
+    back_ = value;
+    ++size_;
+    stats_.On_push(size_);
+  }
+
+  template <typename... Args>
+  void Insert_many_back(Args &&...args) {
+    (Push_back(std::forward<Args>(args)), ...);
+  }
+
+  void Pop_front() {
+    if (Empty()) throw std::out_of_range("List is empty");
+    if (head_begin_ < head_end_) {
+      if (++head_begin_ == head_end_ && first_) Load_head();
+    } else if (++tail_begin_ == tail_end_) {
+      tail_begin_ = tail_end_ = 0;
+    }
+    --size_;
+    stats_.On_pop();
+  }
+
+  // Merges two sorted lists into this one, leaving `other` empty. Both are
+  // decoded and the result re-encoded, O(n + m). The result is built with
+  // this list's stats, so its blocks and the freed old ones are counted.
+  void Merge(CompressedList &other) {
+    if (this != &other && !other.Empty()) {
+      CompressedList merged;
+      std::swap(stats_, merged.stats_);
+      try {
+        auto a = Begin();
+        auto b = other.Begin();
+        while (a != End() && b != other.End()) {
+          if (*a < *b) {
+            merged.Push_back(*a++);
+          } else {
+            merged.Push_back(*b++);
+          }
+        }
+        for (; a != End(); ++a) merged.Push_back(*a);
+        for (; b != other.End(); ++b) merged.Push_back(*b);
+      } catch (...) {
+        merged.Clear();
+        std::swap(stats_, merged.stats_);
+        throw;
+      }
+      Swap_storage(merged);
+      merged.Clear();
+      std::swap(stats_, merged.stats_);
+      other.Clear();
+      stats_.On_merge(size_);
+    }
+  }
+
+  void Swap(CompressedList &other) noexcept {
+    Swap_storage(other);
+    std::swap(stats_, other.stats_);
+  }
+
+  ContainerStats Stats() const { return stats_.Snapshot(); }
+
+ private:
+  using Wide = std::conditional_t<std::is_signed_v<T>, int64_t, uint64_t>;
+
+  // The tail buffer is full. If nothing precedes it, it simply becomes the
+  // head buffer; otherwise it is encoded onto the end of the block chain.
+  // Only the former can start with popped slots.
+  void Flush_tail() {
+    if (head_begin_ == head_end_ && !first_) {
+      std::swap(head_, tail_);
+      head_begin_ = tail_begin_;
+      head_end_ = kBlock;
+      if (!tail_) tail_ = std::make_unique<T[]>(kBlock);
+    } else {
+      uint64_t values[kBlock];
+      for (size_t i = 0; i < kBlock; ++i) {
+        values[i] = static_cast<uint64_t>(static_cast<Wide>(tail_[i]));
+      }
+      Block *block = Block::Encode(values);
+      stats_.On_allocate();
+      block_bytes_ += block->Bytes();
+      (last_ ? last_->next : first_) = block;
+      last_ = block;
+    }
+    tail_begin_ = tail_end_ = 0;
+  }
+
+  // The head buffer ran dry: decode the first block into it.
+  void Load_head() {
+    if (!head_) head_ = std::make_unique<T[]>(kBlock);
+    Block *block = first_;
+    Decode(block, head_.get());
+    first_ = block->next;
+    if (!first_) last_ = nullptr;
+    block_bytes_ -= block->Bytes();
+    Block::Destroy(block);
+    stats_.On_free();
+    head_begin_ = 0;
+    head_end_ = kBlock;
+  }
+
+  // 64-bit T (signed or not) may be written through uint64_t directly.
+  static void Decode(const Block *block, T *out) {
+    if constexpr (std::is_same_v<std::make_unsigned_t<T>, uint64_t>) {
+      block->Decode(reinterpret_cast<uint64_t *>(out));
+    } else {
+      uint64_t values[kBlock];
+      block->Decode(values);
+      for (size_t i = 0; i < kBlock; ++i) out[i] = static_cast<T>(values[i]);
+    }
+  }
+
+  void Swap_storage(CompressedList &other) noexcept {
+    std::swap(first_, other.first_);
+    std::swap(last_, other.last_);
+    std::swap(head_, other.head_);
+    std::swap(tail_, other.tail_);
+    std::swap(head_begin_, other.head_begin_);
+    std::swap(head_end_, other.head_end_);
+    std::swap(tail_begin_, other.tail_begin_);
+    std::swap(tail_end_, other.tail_end_);
+    std::swap(back_, other.back_);
+    std::swap(block_bytes_, other.block_bytes_);
+    std::swap(size_, other.size_);
+  }
+
+  // Elements in order: head_[head_begin_, head_end_), the blocks from
+  // first_, then tail_[tail_begin_, tail_end_). The head buffer is only
+  // empty when there are no blocks.
+  Block *first_ = nullptr;
+  Block *last_ = nullptr;
+  std::unique_ptr<T[]> head_;
+  std::unique_ptr<T[]> tail_;
+  size_type head_begin_ = 0;
+  size_type head_end_ = 0;
+  size_type tail_begin_ = 0;
+  size_type tail_end_ = 0;
+  T back_ = T();
+  size_type block_bytes_ = 0;
+  size_type size_ = 0;
+  [[no_unique_address]] StatsPolicy stats_;
+};
+}  // namespace s21
+
+#endif
@@ -0,0 +1,153 @@
+#ifndef S21_CONCURRENT_LIST_H
+#define S21_CONCURRENT_LIST_H
+
+#include <atomic>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <optional>
+
+namespace s21 {
+// Sorted set backed by a singly linked list with one mutex per node. Every
+// operation walks the list hand over hand: the lock of the next node is
+// taken before the lock of the current one is dropped, so threads working
+// on different parts of the list never wait for each other, and nobody can
+// unlink a node another thread is standing on. Locks are only ever held by
+// std::unique_lock, so an exception from T leaves the list usable.
+template <typename T>
+class ConcurrentList {
+ private:
+  struct Node;
+  // The head sentinel carries a link and a lock but no value, so T does not
+  // need to be default constructible.
+  struct Link {
+    Node *next = nullptr;
+    std::mutex lock;
+  };
+  struct Node : Link {
+    T value;
+    Node(const T &val, Node *nxt) : value(val) { this->next = nxt; }
+  };
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+
+  ConcurrentList() = default;
+  ConcurrentList(std::initializer_list<value_type> const &items) {
+    for (const auto &item : items) Insert(item);
+  }
+  ConcurrentList(const ConcurrentList &) = delete;
+  ConcurrentList &operator=(const ConcurrentList &) = delete;
+  ~ConcurrentList() {
+    Node *node = head_.next;
+    while (node) {
+      Node *next = node->next;
+      delete node;
+      node = next;
+    }
+  }
+
+  // Returns false when an equivalent element is already present. The node
+  // is built before any lock is taken, so a throwing copy of T cannot
+  // happen while the window is held.
+  bool Insert(const_reference value) {
+    auto node = std::make_unique<Node>(value, nullptr);
+    Window window = Locate(value);
+    if (window.Holds(value)) return false;
+    node->next = window.curr;
+    window.pred->next = node.release();
+    size_.fetch_add(1, std::memory_order_relaxed);
+    return true;
+  }
+
+  // Returns false when no equivalent element is present.
+  bool Erase(const_reference value) {
+    Node *victim = nullptr;
+    {
+      Window window = Locate(value);
+      if (window.Holds(value)) {
+        victim = window.curr;
+        window.pred->next = victim->next;
+        size_.fetch_sub(1, std::memory_order_relaxed);
+      }
+    }
+    // Nobody else can reach the node now: reaching it requires the lock of
+    // its predecessor, which we held while unlinking it.
+    delete victim;
+    return victim != nullptr;
+  }
+
+  // Copy of the stored element equivalent to `value`, if any.
+  std::optional<value_type> Find(const_reference value) const {
+    Window window = Locate(value);
+    std::optional<value_type> found;
+    if (window.Holds(value)) found = window.curr->value;
+    return found;
+  }
+
+  bool Contains(const_reference value) const {
+    return Locate(value).Holds(value);
+  }
+
+  // Visits the elements in order. Each element is locked while fn runs on
+  // it, so fn sees a consistent value but the list as a whole may change
+  // behind the traversal.
+  template <typename Fn>
+  void For_each(Fn fn) const {
+    std::unique_lock<std::mutex> held(head_.lock);
+    for (Node *curr = head_.next; curr; curr = curr->next) {
+      std::unique_lock<std::mutex> next(curr->lock);
+      held = std::move(next);
+      fn(static_cast<const_reference>(curr->value));
+    }
+  }
+
+  // Approximate while other threads are modifying the list.
+  size_type Size() const { return size_.load(std::memory_order_relaxed); }
+  bool Empty() const { return Size() == 0; }
+
+ private:
+  // Two adjacent nodes, both locked until the window goes out of scope:
+  // `pred` is the last node ordered before the searched value and `curr`
+  // (possibly null) is the node after it.
+  struct Window {
+    Link *pred = nullptr;
+    Node *curr = nullptr;
+    std::unique_lock<std::mutex> pred_lock;
+    std::unique_lock<std::mutex> curr_lock;
+
+    bool Holds(const_reference value) const {
+      return curr && !(value < curr->value);
+    }
+  };
+
+  // Moving curr_lock into pred_lock releases the old predecessor only after
+  // its successor is locked.
+  Window Locate(const_reference value) const {
+    Window window;
+    window.pred = &head_;
+    window.pred_lock = std::unique_lock<std::mutex>(head_.lock);
+    window.curr = head_.next;
+    if (window.curr) {
+      window.curr_lock = std::unique_lock<std::mutex>(window.curr->lock);
+    }
+    while (window.curr && window.curr->value < value) {
+      window.pred_lock = std::move(window.curr_lock);
+      window.pred = window.curr;
+      window.curr = window.curr->next;
+      if (window.curr) {
+        window.curr_lock = std::unique_lock<std::mutex>(window.curr->lock);
+      }
+    }
+    return window;
+  }
+
+  mutable Link head_;
+  std::atomic<size_type> size_{0};
+};
+}  // namespace s21
+
+#endif
@@ -0,0 +1,203 @@
+#ifndef S21_INDEXED_LIST_H
+#define S21_INDEXED_LIST_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+namespace s21 {
+// Doubly linked list with an order-statistic index. Besides next/prev, every
+// node sits in an implicit treap keyed by position whose subtrees know their
+// size. Iteration and iterator stability are those of List; positional
+// access, rank lookups and binary search in a sorted list become O(log n)
+// expected instead of O(n).
+template <typename T>
+class IndexedList {
+ private:
+  struct Node {
+    T value;
+    Node *next = nullptr;
+    Node *prev = nullptr;
+    Node *left = nullptr;
+    Node *right = nullptr;
+    Node *parent = nullptr;
+    size_t size = 1;
+    uint32_t priority;
+    Node(const T &val, uint32_t prio) : value(val), priority(prio) {}
+  };
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+  using difference_type = std::ptrdiff_t;
+
+  class IndexedListConstIterator {
+   public:
+    using value_type = T;
+    using reference = const T &;
+    using pointer = const T *;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::bidirectional_iterator_tag;
+
+    IndexedListConstIterator(const Node *ptr = nullptr) : ptr_(ptr) {}
+    reference operator*() const {
+      if (!ptr_) throw std::out_of_range("Iterator dereference null pointer");
+      return ptr_->value;
+    }
+    pointer operator->() const { return &**this; }
+    IndexedListConstIterator &operator++() {
+      if (ptr_) ptr_ = ptr_->next;
+      return *this;
+    }
+    IndexedListConstIterator operator++(int) {
+      IndexedListConstIterator tmp = *this;
+      ++(*this);
+      return tmp;
+    }
+    IndexedListConstIterator &operator--() {
+      if (ptr_) ptr_ = ptr_->prev;
+      return *this;
+    }
+    IndexedListConstIterator operator--(int) {
+      IndexedListConstIterator tmp = *this;
+      --(*this);
+      return tmp;
+    }
+    bool operator==(const IndexedListConstIterator &other) const {
+      return ptr_ == other.ptr_;
+    }
+    bool operator!=(const IndexedListConstIterator &other) const {
+      return ptr_ != other.ptr_;
+    }
+
+   private:
+    const Node *ptr_;
+    friend class IndexedList;
+  };
+
+  class IndexedListIterator {
+   public:
+    using value_type = T;
+    using reference = T &;
+    using pointer = T *;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::bidirectional_iterator_tag;
+
+    IndexedListIterator(Node *ptr = nullptr) : ptr_(ptr) {}
+    IndexedListIterator(const IndexedListConstIterator &it)
+        : ptr_(const_cast<Node *>(it.ptr_)) {}
+    operator IndexedListConstIterator() const {
+      return IndexedListConstIterator(ptr_);
+    }
+    reference operator*() const {
+      if (!ptr_) throw std::out_of_range("Iterator dereference null pointer");
+      return ptr_->value;
+    }
+    pointer operator->() const { return &**this; }
+    IndexedListIterator &operator++() {
+      if (ptr_) ptr_ = ptr_->next;
+      return *this;
+    }
+    IndexedListIterator operator++(int) {
+      IndexedListIterator tmp = *this;
+      ++(*this);
+      return tmp;
+    }
+    IndexedListIterator &operator--() {
+      if (ptr_) ptr_ = ptr_->prev;
+      return *this;
+    }
+    IndexedListIterator operator--(int) {
+      IndexedListIterator tmp = *this;
+      --(*this);
+      return tmp;
+    }
+    bool operator==(const IndexedListIterator &other) const {
+      return ptr_ == other.ptr_;
+    }
+    bool operator!=(const IndexedListIterator &other) const {
+      return ptr_ != other.ptr_;
+    }
+
+   private:
+    Node *ptr_;
+    friend class IndexedList;
+  };
+
+  using iterator = IndexedListIterator;
+  using const_iterator = IndexedListConstIterator;
+
+  IndexedList();
+  IndexedList(std::initializer_list<value_type> const &items);
+  IndexedList(const IndexedList &l);
+  IndexedList(IndexedList &&l);
+  ~IndexedList();
+  IndexedList &operator=(IndexedList &&l);
+
+  const_reference Front() const;
+  const_reference Back() const;
+
+  iterator Begin() { return iterator(head_); }
+  const_iterator Cbegin() const { return const_iterator(head_); }
+  iterator End() { return iterator(nullptr); }
+  const_iterator Cend() const { return const_iterator(nullptr); }
+
+  bool Empty() const { return size_ == 0; }
+  size_type Size() const { return size_; }
+
+  void Clear();
+  iterator Insert(iterator pos, const_reference value);
+  void Erase(iterator pos);
+  void Push_back(const_reference value);
+  void Pop_back();
+  void Push_front(const_reference value);
+  void Pop_front();
+  void Swap(IndexedList &other);
+  void Splice(iterator pos, IndexedList &other);
+  void Sort();
+
+  // Element at position k, O(log n). Throws std::out_of_range past the end.
+  reference At(size_type k);
+  const_reference At(size_type k) const;
+  // Position of `pos`, Size() for End(), O(log n).
+  size_type Index_of(const_iterator pos) const;
+  // Iterator k steps away from `it` (negative k moves back), O(log n).
+  // Throws std::out_of_range if that leaves [Begin(), End()].
+  iterator Advance(iterator it, difference_type k);
+  // Binary searches that require the list to be sorted by operator<.
+  iterator Lower_bound(const_reference value);
+  iterator Upper_bound(const_reference value);
+  // Inserts after every element not greater than `value`, keeping a
+  // sorted list sorted, O(log n).
+  iterator Insert_sorted(const_reference value);
+
+ private:
+  static size_type Size_of(const Node *node) { return node ? node->size : 0; }
+  static void Update(Node *node);
+  static Node *Merge_trees(Node *left, Node *right);
+  static void Split_tree(Node *root, size_type k, Node *&left, Node *&right);
+  Node *Node_at(size_type k) const;
+  Node *Create_node(const_reference value);
+  // Links `node` in front of `next_node` (null for the end), which sits at
+  // position `index`.
+  iterator Insert_before(size_type index, Node *next_node, Node *node);
+  uint32_t Next_priority();
+
+  Node *root_;
+  Node *head_;
+  Node *tail_;
+  size_type size_;
+  uint32_t seed_;
+};
+}  // namespace s21
+
+#include "s21_indexed_list.tpp"
+
+#endif
@@ -0,0 +1,359 @@
+#ifndef S21_INDEXED_LIST_TPP
+#define S21_INDEXED_LIST_TPP
+
+#include "s21_indexed_list.h"
+
+namespace s21 {
+template <typename T>
+IndexedList<T>::IndexedList()
+    : root_(nullptr),
+      head_(nullptr),
+      tail_(nullptr),
+      size_(0),
+      seed_(2463534242u) {}
+
+template <typename T>
+IndexedList<T>::IndexedList(std::initializer_list<value_type> const &items)
+    : IndexedList() {
+  for (const auto &item : items) {
+    Push_back(item);
+  }
+}
+
+template <typename T>
+IndexedList<T>::IndexedList(const IndexedList &l) : IndexedList() {
+  for (const_iterator it = l.Cbegin(); it != l.Cend(); ++it) {
+    Push_back(*it);
+  }
+}
+
+template <typename T>
+IndexedList<T>::IndexedList(IndexedList &&l) : IndexedList() {
+  Swap(l);
+}
+
+template <typename T>
+IndexedList<T>::~IndexedList() {
+  Clear();
+}
+
+template <typename T>
+IndexedList<T> &IndexedList<T>::operator=(IndexedList &&l) {
+  if (this != &l) {
+    Clear();
+    Swap(l);
+  }
+  return *this;
+}
+
+template <typename T>
+typename IndexedList<T>::const_reference IndexedList<T>::Front() const {
+  if (Empty()) throw std::out_of_range("List is empty");
+  return head_->value;
+}
+
+template <typename T>
+typename IndexedList<T>::const_reference IndexedList<T>::Back() const {
+  if (Empty()) throw std::out_of_range("List is empty");
+  return tail_->value;
+}
+
+template <typename T>
+void IndexedList<T>::Clear() {
+  while (head_ != nullptr) {
+    Node *tmp = head_;
+    head_ = head_->next;
+    delete tmp;
+  }
+  root_ = tail_ = nullptr;
+  size_ = 0;
+}
+
+template <typename T>
+typename IndexedList<T>::iterator IndexedList<T>::Insert(
+    iterator pos, const_reference value) {
+  return Insert_before(Index_of(pos), pos.ptr_, Create_node(value));
+}
+
+template <typename T>
+void IndexedList<T>::Erase(iterator pos) {
+  if (!pos.ptr_) {
+    throw std::out_of_range("Cannot erase at end iterator");
+  }
+  Node *node = pos.ptr_;
+  (node->prev ? node->prev->next : head_) = node->next;
+  (node->next ? node->next->prev : tail_) = node->prev;
+
+  Node *child = Merge_trees(node->left, node->right);
+  Node *parent = node->parent;
+  if (child) child->parent = parent;
+  if (!parent) {
+    root_ = child;
+  } else if (parent->left == node) {
+    parent->left = child;
+  } else {
+    parent->right = child;
+  }
+  for (; parent; parent = parent->parent) {
+    parent->size = 1 + Size_of(parent->left) + Size_of(parent->right);
+  }
+
+  delete node;
+  size_--;
+}
+
+template <typename T>
+void IndexedList<T>::Push_back(const_reference value) {
+  Insert_before(size_, nullptr, Create_node(value));
+}
+
+template <typename T>
+void IndexedList<T>::Pop_back() {
+  if (Empty()) throw std::out_of_range("List is empty");
+  Erase(iterator(tail_));
+}
+
+template <typename T>
+void IndexedList<T>::Push_front(const_reference value) {
+  Insert_before(0, head_, Create_node(value));
+}
+
+template <typename T>
+void IndexedList<T>::Pop_front() {
+  if (Empty()) throw std::out_of_range("List is empty");
+  Erase(iterator(head_));
+}
+
+template <typename T>
+void IndexedList<T>::Swap(IndexedList &other) {
+  std::swap(root_, other.root_);
+  std::swap(head_, other.head_);
+  std::swap(tail_, other.tail_);
+  std::swap(size_, other.size_);
+  std::swap(seed_, other.seed_);
+}
+
+template <typename T>
+void IndexedList<T>::Splice(iterator pos, IndexedList &other) {
+  if (!other.Empty() && this != &other) {
+    Node *next_node = pos.ptr_;
+    Node *prev_node = next_node ? next_node->prev : tail_;
+    (prev_node ? prev_node->next : head_) = other.head_;
+    other.head_->prev = prev_node;
+    (next_node ? next_node->prev : tail_) = other.tail_;
+    other.tail_->next = next_node;
+
+    Node *left = nullptr;
+    Node *right = nullptr;
+    Split_tree(root_, Index_of(pos), left, right);
+    root_ = Merge_trees(Merge_trees(left, other.root_), right);
+    root_->parent = nullptr;
+    size_ += other.size_;
+
+    other.root_ = other.head_ = other.tail_ = nullptr;
+    other.size_ = 0;
+  }
+}
+
+template <typename T>
+void IndexedList<T>::Sort() {
+  if (size_ >= 2) {
+    std::unique_ptr<Node *[]> nodes(new Node *[size_]);
+    size_type count = 0;
+    for (Node *node = head_; node; node = node->next) nodes[count++] = node;
+    std::stable_sort(nodes.get(), nodes.get() + count,
+                     [](const Node *a, const Node *b) {
+                       return a->value < b->value;
+                     });
+
+    // Relink in the new order and rebuild the treap in linear time: the
+    // stack holds the right spine, and a node is final once popped.
+    std::unique_ptr<Node *[]> spine(new Node *[count]);
+    size_type depth = 0;
+    for (size_type i = 0; i < count; ++i) {
+      Node *node = nodes[i];
+      node->prev = i ? nodes[i - 1] : nullptr;
+      node->next = i + 1 < count ? nodes[i + 1] : nullptr;
+      node->left = node->right = node->parent = nullptr;
+      Node *last = nullptr;
+      while (depth && spine[depth - 1]->priority < node->priority) {
+        last = spine[--depth];
+        Update(last);
+      }
+      node->left = last;
+      if (depth) spine[depth - 1]->right = node;
+      spine[depth++] = node;
+    }
+    while (depth) Update(spine[--depth]);
+    root_ = spine[0];
+    root_->parent = nullptr;
+    head_ = nodes[0];
+    tail_ = nodes[count - 1];
+  }
+}
+
+template <typename T>
+typename IndexedList<T>::reference IndexedList<T>::At(size_type k) {
+  if (k >= size_) throw std::out_of_range("Index out of range");
+  return Node_at(k)->value;
+}
+
+template <typename T>
+typename IndexedList<T>::const_reference IndexedList<T>::At(
+    size_type k) const {
+  if (k >= size_) throw std::out_of_range("Index out of range");
+  return Node_at(k)->value;
+}
+
+template <typename T>
+typename IndexedList<T>::size_type IndexedList<T>::Index_of(
+    const_iterator pos) const {
+  const Node *node = pos.ptr_;
+  size_type index = size_;
+  if (node) {
+    index = Size_of(node->left);
+    for (; node->parent; node = node->parent) {
+      if (node->parent->right == node) {
+        index += Size_of(node->parent->left) + 1;
+      }
+    }
+  }
+  return index;
+}
+
+template <typename T>
+typename IndexedList<T>::iterator IndexedList<T>::Advance(
+    iterator it, difference_type k) {
+  difference_type index = static_cast<difference_type>(Index_of(it)) + k;
+  if (index < 0 || index > static_cast<difference_type>(size_)) {
+    throw std::out_of_range("Advance past the list bounds");
+  }
+  return iterator(Node_at(static_cast<size_type>(index)));
+}
+
+template <typename T>
+typename IndexedList<T>::iterator IndexedList<T>::Lower_bound(
+    const_reference value) {
+  Node *result = nullptr;
+  for (Node *node = root_; node;) {
+    if (node->value < value) {
+      node = node->right;
+    } else {
+      result = node;
+      node = node->left;
+    }
+  }
+  return iterator(result);
+}
+
+template <typename T>
+typename IndexedList<T>::iterator IndexedList<T>::Upper_bound(
+    const_reference value) {
+  Node *result = nullptr;
+  for (Node *node = root_; node;) {
+    if (value < node->value) {
+      result = node;
+      node = node->left;
+    } else {
+      node = node->right;
+    }
+  }
+  return iterator(result);
+}
+
+template <typename T>
+typename IndexedList<T>::iterator IndexedList<T>::Insert_sorted(
+    const_reference value) {
+  return Insert(Upper_bound(value), value);
+}
+
+template <typename T>
+void IndexedList<T>::Update(Node *node) {
+  node->size = 1 + Size_of(node->left) + Size_of(node->right);
+  if (node->left) node->left->parent = node;
+  if (node->right) node->right->parent = node;
+}
+
+template <typename T>
+typename IndexedList<T>::Node *IndexedList<T>::Merge_trees(Node *left,
+                                                           Node *right) {
+  Node *root = left ? left : right;
+  if (left && right) {
+    if (left->priority > right->priority) {
+      left->right = Merge_trees(left->right, right);
+      Update(left);
+    } else {
+      right->left = Merge_trees(left, right->left);
+      Update(right);
+      root = right;
+    }
+  }
+  return root;
+}
+
+// Moves the first k positions of `root` into `left` and the rest into
+// `right`.
+template <typename T>
+void IndexedList<T>::Split_tree(Node *root, size_type k, Node *&left,
+                                Node *&right) {
+  if (!root) {
+    left = right = nullptr;
+  } else if (Size_of(root->left) < k) {
+    Split_tree(root->right, k - Size_of(root->left) - 1, root->right, right);
+    Update(root);
+    left = root;
+  } else {
+    Split_tree(root->left, k, left, root->left);
+    Update(root);
+    right = root;
+  }
+}
+
+template <typename T>
+typename IndexedList<T>::Node *IndexedList<T>::Node_at(size_type k) const {
+  Node *node = k < size_ ? root_ : nullptr;
+  while (node && Size_of(node->left) != k) {
+    if (k < Size_of(node->left)) {
+      node = node->left;
+    } else {
+      k -= Size_of(node->left) + 1;
+      node = node->right;
+    }
+  }
+  return node;
+}
+
+template <typename T>
+typename IndexedList<T>::Node *IndexedList<T>::Create_node(
+    const_reference value) {
+  return new Node(value, Next_priority());
+}
+
+template <typename T>
+typename IndexedList<T>::iterator IndexedList<T>::Insert_before(
+    size_type index, Node *next_node, Node *node) {
+  Node *prev_node = next_node ? next_node->prev : tail_;
+  node->prev = prev_node;
+  node->next = next_node;
+  (prev_node ? prev_node->next : head_) = node;
+  (next_node ? next_node->prev : tail_) = node;
+
+  Node *left = nullptr;
+  Node *right = nullptr;
+  Split_tree(root_, index, left, right);
+  root_ = Merge_trees(Merge_trees(left, node), right);
+  root_->parent = nullptr;
+  size_++;
+  return iterator(node);
+}
+
+template <typename T>
+uint32_t IndexedList<T>::Next_priority() {
+  seed_ ^= seed_ << 13;
+  seed_ ^= seed_ >> 17;
+  seed_ ^= seed_ << 5;
+  return seed_;
+}
+}  // namespace s21
+
+#endif
@@ -1,20 +1,72 @@
 #ifndef S21_LIST_H
 #define S21_LIST_H
 
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <exception>
 #include <initializer_list>
 #include <iostream>
+#include <iterator>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "s21_list_simd.h"
+#include "s21_list_stats.h"
+#include "s21_node_arena.h"
+#include "s21_node_reclaimer.h"
 
 namespace s21 {
-template <typename T>
+namespace detail {
+// Building with -DS21_LIST_PREFETCH makes iteration and Sort issue a
+// software prefetch for the node after the one being stepped to. Fragmented
+// lists then overlap two cache misses instead of taking them one at a time.
+template <typename Node>
+inline void Prefetch_next(const Node *node) {
+#if defined(S21_LIST_PREFETCH) && (defined(__GNUC__) || defined(__clang__))
+  if (node) __builtin_prefetch(node->next);
+#else
+  (void)node;
+#endif
+}
+
+struct NoArena {};
+}  // namespace detail
+
+// Node storage policies for List. With the default HeapNodes every node is
+// allocated on its own and a List is just its two ends and its size.
+// ArenaNodes adds Reserve, Compact and Set_reclaimer: the list then also
+// keeps a NodeArena and a NodeReclaimer pointer, and every node carries an
+// ArenaTag, which takes a word more per node for 8-byte T.
+struct HeapNodes {
+  static constexpr bool kArena = false;
+};
+struct ArenaNodes {
+  static constexpr bool kArena = true;
+};
+
+template <typename T, typename StatsPolicy = NoStats,
+          typename NodePolicy = HeapNodes>
 class List {
  private:
+  static constexpr bool kArena = NodePolicy::kArena;
+
   struct ListNode {
     T value;
+    // Sits in the padding after `value` for most small T; takes no space
+    // at all with HeapNodes.
+    [[no_unique_address]] std::conditional_t<kArena, detail::ArenaTag,
+                                             detail::NoArena> arena_tag{};
     ListNode *next;
     ListNode *prev;
     ListNode(const T &val = T(), ListNode *nxt = nullptr,
              ListNode *prv = nullptr)
         : value(val), next(nxt), prev(prv) {}
+    ListNode(T &&val, ListNode *nxt, ListNode *prv)
+        : value(std::move(val)), next(nxt), prev(prv) {}
   };
 
  public:
@@ -31,11 +83,15 @@ class List {
     using difference_type = std::ptrdiff_t;
     using iterator_category = std::bidirectional_iterator_tag;
 
-    ListConstIterator(const ListNode *ptr = nullptr) : ptr_(ptr) {}
-    ListConstIterator(const ListConstIterator &other) : ptr_(other.ptr_) {}
+    ListConstIterator(const ListNode *ptr = nullptr,
+                      const List *list = nullptr)
+        : ptr_(ptr), list_(list) {}
+    ListConstIterator(const ListConstIterator &other)
+        : ptr_(other.ptr_), list_(other.list_) {}
     ListConstIterator &operator=(const ListConstIterator &other) {
       if (this != &other) {
         ptr_ = other.ptr_;
+        list_ = other.list_;
       }
       return *this;
     }
@@ -48,7 +104,10 @@ class List {
       return &ptr_->value;
     }
     ListConstIterator &operator++() {
-      if (ptr_) ptr_ = ptr_->next;
+      if (ptr_) {
+        ptr_ = ptr_->next;
+        detail::Prefetch_next(ptr_);
+      }
       return *this;
     }
     ListConstIterator operator++(int) {
@@ -56,8 +115,13 @@ class List {
       ++(*this);
       return tmp;
     }
+    // Stepping back from End() lands on the last element.
     ListConstIterator &operator--() {
-      if (ptr_) ptr_ = ptr_->prev;
+      if (ptr_) {
+        ptr_ = ptr_->prev;
+      } else if (list_) {
+        ptr_ = list_->tail_;
+      }
       return *this;
     }
     ListConstIterator operator--(int) {
@@ -74,6 +138,8 @@ class List {
 
    private:
     const ListNode *ptr_;
+    // Owning list, so that End() can be decremented.
+    const List *list_;
     friend class List;
   };
 
@@ -85,10 +151,15 @@ class List {
     using difference_type = std::ptrdiff_t;
     using iterator_category = std::bidirectional_iterator_tag;
 
-    ListIterator(ListNode *ptr = nullptr) : ptr_(ptr) {}
-    ListIterator(const ListIterator &other) : ptr_(other.ptr_) {}
+    ListIterator(ListNode *ptr = nullptr, const List *list = nullptr)
+        : ptr_(ptr), list_(list) {}
+    ListIterator(const ListIterator &other)
+        : ptr_(other.ptr_), list_(other.list_) {}
     ListIterator(const ListConstIterator &it)
-        : ptr_(const_cast<ListNode *>(it.ptr_)) {}
+        : ptr_(const_cast<ListNode *>(it.ptr_)), list_(it.list_) {}
+    operator ListConstIterator() const {
+      return ListConstIterator(ptr_, list_);
+    }
     reference operator*() const {
       if (!ptr_) throw std::out_of_range("Iterator dereference null pointer");
       return ptr_->value;
@@ -98,7 +169,10 @@ class List {
       return &ptr_->value;
     }
     ListIterator &operator++() {
-      if (ptr_) ptr_ = ptr_->next;
+      if (ptr_) {
+        ptr_ = ptr_->next;
+        detail::Prefetch_next(ptr_);
+      }
       return *this;
     }
     ListIterator operator++(int) {
@@ -106,8 +180,13 @@ class List {
       ++(*this);
       return tmp;
     }
+    // Stepping back from End() lands on the last element.
     ListIterator &operator--() {
-      if (ptr_) ptr_ = ptr_->prev;
+      if (ptr_) {
+        ptr_ = ptr_->prev;
+      } else if (list_) {
+        ptr_ = list_->tail_;
+      }
       return *this;
     }
     ListIterator operator--(int) {
@@ -124,12 +203,32 @@ class List {
     ListIterator &operator=(const ListIterator &other) {
       if (this != &other) {
         ptr_ = other.ptr_;
+        list_ = other.list_;
       }
       return *this;
     }
+    // Mixed comparisons. Each side converts to the other, so without exact
+    // matches `it == cit` would be ambiguous.
+    friend bool operator==(const ListIterator &lhs,
+                           const ListConstIterator &rhs) {
+      return ListConstIterator(lhs) == rhs;
+    }
+    friend bool operator==(const ListConstIterator &lhs,
+                           const ListIterator &rhs) {
+      return lhs == ListConstIterator(rhs);
+    }
+    friend bool operator!=(const ListIterator &lhs,
+                           const ListConstIterator &rhs) {
+      return ListConstIterator(lhs) != rhs;
+    }
+    friend bool operator!=(const ListConstIterator &lhs,
+                           const ListIterator &rhs) {
+      return lhs != ListConstIterator(rhs);
+    }
 
    private:
     ListNode *ptr_;
+    const List *list_;
     friend class List;
   };
 
@@ -142,34 +241,109 @@ class List {
   List(const List &l);
   List(List &&l);
   ~List();
+  List &operator=(const List &l);
   List &operator=(List &&l);
 
+  // Replace the contents. Existing nodes are overwritten in place, so only
+  // the difference in length is allocated or freed.
+  void Assign(size_type n, const_reference value);
+  void Assign(std::initializer_list<value_type> const &items);
+  template <std::input_iterator InputIt>
+  void Assign(InputIt first, InputIt last);
+
   const_reference Front() const;
   const_reference Back() const;
 
   iterator Begin();
   const_iterator Cbegin() const;
-  iterator End() { return iterator(nullptr); }
-  const_iterator Cend() const { return const_iterator(nullptr); }
+  iterator End() { return iterator(nullptr, this); }
+  const_iterator Cend() const { return const_iterator(nullptr, this); }
+
+  // Standard spellings of the above, which make List a
+  // std::ranges::bidirectional_range and sized_range usable with range-for,
+  // std::ranges algorithms and views.
+  iterator begin() { return Begin(); }
+  iterator end() { return End(); }
+  const_iterator begin() const { return Cbegin(); }
+  const_iterator end() const { return Cend(); }
+  size_type size() const { return Size(); }
 
   bool Empty() const { return size_ == 0 && head_ == nullptr; }
   size_type Size() const;
   size_type Max_size();
 
   void Clear();
+  // Frees at most `budget` nodes from the front and returns how many are
+  // left, for callers that spread a large teardown over several steps.
+  size_type Clear_incremental(size_type budget);
+  // With a reclaimer set, Clear() and the destructor detach the node chain
+  // in O(1) and leave freeing it to the reclaimer's thread. Lists created
+  // from this one by copy or move inherit the setting, move assignment
+  // takes it over along with the nodes and Swap exchanges it; nullptr turns
+  // it off.
+  void Set_reclaimer(NodeReclaimer *reclaimer)
+    requires kArena
+  {
+    nodes_.reclaimer = reclaimer;
+  }
   iterator Insert(iterator pos, const_reference value);
   void Erase(iterator pos);
   void Push_back(const_reference value);
+  void Push_back(value_type &&value);
   void Pop_back();
   void Push_front(const_reference value);
   void Pop_front();
   void Swap(List &other);
   void Merge(List &other);
   void Splice(iterator pos, List &other);
+  // Moves the single node `it` of `other` (which may be this list) in front
+  // of `pos` without copying it. O(1); iterators to the node stay valid.
+  void Splice(iterator pos, List &other, iterator it);
   void Reverse();
   void Unique();
   void Sort();
 
+  // Relinking algorithms: nodes are rewired in place, nothing is allocated,
+  // copied or moved, and iterators stay valid.
+  //
+  // Cuts the list before `pos` and returns [pos, End()) as a new list.
+  // Finding the size of the tail walks it; passing `count`, the number of
+  // elements from `pos` to the end, makes the cut O(1).
+  List Split(iterator pos);
+  List Split(iterator pos, size_type count);
+  // Moves the elements for which `pred` holds in front of the others and
+  // returns an iterator to the first of the others (End() if none). Both
+  // groups keep their relative order. If `pred` throws, every element is
+  // still in the list, in unspecified order. The overloads taking
+  // `threads` partition equal chunks concurrently and join the chains
+  // afterwards; `pred` must then be safe to call from several threads.
+  template <typename Pred>
+  iterator Stable_partition(Pred pred);
+  template <typename Pred>
+  iterator Stable_partition(Pred pred, size_type threads);
+  // Same as Stable_partition: a single relinking pass already keeps the
+  // order at no extra cost.
+  template <typename Pred>
+  iterator Partition(Pred pred) {
+    return Stable_partition(std::move(pred));
+  }
+  template <typename Pred>
+  iterator Partition(Pred pred, size_type threads) {
+    return Stable_partition(std::move(pred), threads);
+  }
+  // Makes `middle` the first element in O(1) and returns an iterator to the
+  // element that used to be first.
+  iterator Rotate(iterator middle);
+
+  // Pre-allocates n nodes that the next insertions draw from in address
+  // order, so sequentially pushed elements land next to each other.
+  void Reserve(size_type n)
+    requires kArena;
+  // Moves every node into contiguous blocks laid out in iteration order and
+  // relinks them. Iterators are invalidated.
+  void Compact()
+    requires kArena;
+
   template <typename... Args>
   iterator Insert_many(const_iterator pos, Args &&...args);
   template <typename... Args>
@@ -177,11 +351,85 @@ class List {
   template <typename... Args>
   void Insert_many_front(Args &&...args);
 
+  // Bulk queries. Runs of nodes that sit back to back in memory (see
+  // Reserve and Compact) are scanned with SIMD kernels, the rest of the
+  // list node by node. Floating point sums are not evaluated left to right.
+  value_type Sum() const;
+  value_type Min() const;
+  value_type Max() const;
+  size_type Count(const_reference value) const;
+  bool Contains(const_reference value) const;
+  iterator Find(const_reference value);
+  const_iterator Find(const_reference value) const;
+
+  ContainerStats Stats() const { return stats_.Snapshot(); }
+
  private:
+  template <typename U>
+  ListNode *Create_node(U &&value, ListNode *next = nullptr,
+                        ListNode *prev = nullptr);
+  void Link_back(ListNode *node);
+  void Destroy_node(ListNode *node);
+  bool Defer_clear();
+  void Reserve_for_append(size_type n);
+  void Truncate(ListNode *first);
+  void Sort_impl();
+
+  // Chain of nodes being assembled by the relinking algorithms. Appending
+  // sets prev links; the list's ends are fixed up by Adopt.
+  struct Chain {
+    ListNode *head = nullptr;
+    ListNode *tail = nullptr;
+    void Append(ListNode *node) {
+      node->prev = tail;
+      (tail ? tail->next : head) = node;
+      tail = node;
+    }
+    void Append(const Chain &other) {
+      if (other.head) {
+        other.head->prev = tail;
+        (tail ? tail->next : head) = other.head;
+        tail = other.tail;
+      }
+    }
+  };
+  // One slice of the list for the partition pass: `first` and `count`
+  // advance as nodes are sorted into `yes` and `no`, so after an exception
+  // they describe the nodes not yet visited, ending at `last`.
+  struct PartitionRun {
+    ListNode *first = nullptr;
+    ListNode *last = nullptr;
+    size_type count = 0;
+    Chain yes;
+    Chain no;
+    void Unvisited(Chain &out) const {
+      if (count) out.Append(Chain{first, last});
+    }
+  };
+  template <typename Pred>
+  static void Partition_run(PartitionRun &run, Pred &pred);
+  void Adopt(const Chain &chain);
+
+  const ListNode *Find_node(const_reference value) const;
+  template <typename Fn>
+  void For_each_run(Fn fn) const;
+
+  struct ArenaState {
+    detail::NodeArena<ListNode> *arena = nullptr;
+    NodeReclaimer *reclaimer = nullptr;
+  };
+
   ListNode *head_;
   ListNode *tail_;
   size_type size_;
+  [[no_unique_address]] std::conditional_t<kArena, ArenaState, detail::NoArena>
+      nodes_;
+  [[no_unique_address]] StatsPolicy stats_;
 };
+
+// List whose nodes come from a NodeArena, see ArenaNodes.
+template <typename T, typename StatsPolicy = NoStats>
+using ArenaList = List<T, StatsPolicy, ArenaNodes>;
 }  // namespace s21
 
 #include "s21_list.tpp"
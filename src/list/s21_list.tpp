@@ -4,45 +4,66 @@
 #include "s21_list.h"
 
 namespace s21 {
-template <typename T>
-List<T>::List() : head_(nullptr), tail_(nullptr), size_(0) {}
+template <typename T, typename StatsPolicy, typename NodePolicy>
+List<T, StatsPolicy, NodePolicy>::List()
+    : head_(nullptr), tail_(nullptr), size_(0) {}
 
-template <typename T>
-List<T>::List(size_type n) : head_(nullptr), tail_(nullptr), size_(0) {
+template <typename T, typename StatsPolicy, typename NodePolicy>
+List<T, StatsPolicy, NodePolicy>::List(size_type n) : List() {
   for (size_type i = 0; i < n; ++i) {
     Push_back(T());
   }
 }
 
-template <typename T>
-List<T>::List(std::initializer_list<value_type> const &items)
-    : head_(nullptr), tail_(nullptr), size_(0) {
+template <typename T, typename StatsPolicy, typename NodePolicy>
+List<T, StatsPolicy, NodePolicy>::List(
+    std::initializer_list<value_type> const &items)
+    : List() {
   for (const auto &item : items) {
     Push_back(item);
   }
 }
 
-template <typename T>
-List<T>::List(const List &l) : head_(nullptr), tail_(nullptr), size_(0) {
+template <typename T, typename StatsPolicy, typename NodePolicy>
+List<T, StatsPolicy, NodePolicy>::List(const List &l) : List() {
+  if constexpr (kArena) nodes_.reclaimer = l.nodes_.reclaimer;
   for (const_iterator it = l.Cbegin(); it != l.Cend(); ++it) {
     Push_back(*it);
   }
 }
 
-template <typename T>
-List<T>::List(List &&l) : head_(l.head_), tail_(l.tail_), size_(l.size_) {
+template <typename T, typename StatsPolicy, typename NodePolicy>
+List<T, StatsPolicy, NodePolicy>::List(List &&l)
+    : head_(l.head_), tail_(l.tail_), size_(l.size_), nodes_(l.nodes_) {
   l.head_ = nullptr;
   l.tail_ = nullptr;
   l.size_ = 0;
+  if constexpr (kArena) l.nodes_.arena = nullptr;
 }
 
-template <typename T>
-List<T> &List<T>::operator=(List &&l) {
+template <typename T, typename StatsPolicy, typename NodePolicy>
+List<T, StatsPolicy, NodePolicy> &
+List<T, StatsPolicy, NodePolicy>::operator=(const List &l) {
+  if (this != &l) {
+    Assign(l.Cbegin(), l.Cend());
+  }
+  return *this;
+}
+
+template <typename T, typename StatsPolicy, typename NodePolicy>
+List<T, StatsPolicy, NodePolicy> &
+List<T, StatsPolicy, NodePolicy>::operator=(List &&l) {
   if (this != &l) {
     Clear();
     head_ = l.head_;
     tail_ = l.tail_;
     size_ = l.size_;
+    if constexpr (kArena) {
+      delete nodes_.arena;
+      nodes_.arena = l.nodes_.arena;
+      nodes_.reclaimer = l.nodes_.reclaimer;
+      l.nodes_.arena = nullptr;
+    }
     l.head_ = nullptr;
     l.tail_ = nullptr;
     l.size_ = 0;
@@ -50,65 +71,128 @@ List<T> &List<T>::operator=(List &&l) {
   return *this;
 }
 
-template <typename T>
-List<T>::~List() {
+template <typename T, typename StatsPolicy, typename NodePolicy>
+void List<T, StatsPolicy, NodePolicy>::Assign(size_type n,
+                                              const_reference value) {
+  ListNode *node = head_;
+  for (; node && n > 0; node = node->next, --n) {
+    node->value = value;
+  }
+  if (node) {
+    Truncate(node);
+  } else {
+    Reserve_for_append(n);
+    for (; n > 0; --n) Push_back(value);
+  }
+}
+
+template <typename T, typename StatsPolicy, typename NodePolicy>
+void List<T, StatsPolicy, NodePolicy>::Assign(
+    std::initializer_list<value_type> const &items) {
+  Assign(items.begin(), items.end());
+}
+
+template <typename T, typename StatsPolicy, typename NodePolicy>
+template <std::input_iterator InputIt>
+void List<T, StatsPolicy, NodePolicy>::Assign(InputIt first, InputIt last) {
+  ListNode *node = head_;
+  for (; node && first != last; node = node->next, ++first) {
+    node->value = *first;
+  }
+  if (node) {
+    Truncate(node);
+  } else {
+    if constexpr (std::forward_iterator<InputIt>) {
+      Reserve_for_append(static_cast<size_type>(std::distance(first, last)));
+    }
+    for (; first != last; ++first) Push_back(*first);
+  }
+}
+
+template <typename T, typename StatsPolicy, typename NodePolicy>
+List<T, StatsPolicy, NodePolicy>::~List() {
   Clear();
+  if constexpr (kArena) delete nodes_.arena;
 }
 
-template <typename T>
-typename List<T>::const_reference List<T>::Front() const {
+template <typename T, typename StatsPolicy, typename NodePolicy>
+typename List<T, StatsPolicy, NodePolicy>::const_reference
+List<T, StatsPolicy, NodePolicy>::Front() const {
   if (Empty()) throw std::out_of_range("List is empty");
   return head_->value;
 }
 
-template <typename T>
-typename List<T>::const_reference List<T>::Back() const {
+template <typename T, typename StatsPolicy, typename NodePolicy>
+typename List<T, StatsPolicy, NodePolicy>::const_reference
+List<T, StatsPolicy, NodePolicy>::Back() const {
   if (Empty()) throw std::out_of_range("List is empty");
   return tail_->value;
 }
 
-template <typename T>
-typename List<T>::iterator List<T>::Begin() {
-  return iterator(head_);
+template <typename T, typename StatsPolicy, typename NodePolicy>
+typename List<T, StatsPolicy, NodePolicy>::iterator
+List<T, StatsPolicy, NodePolicy>::Begin() {
+  return iterator(head_, this);
 }
 
-template <typename T>
-typename List<T>::const_iterator List<T>::Cbegin() const {
-  return const_iterator(head_);
+template <typename T, typename StatsPolicy, typename NodePolicy>
+typename List<T, StatsPolicy, NodePolicy>::const_iterator
+List<T, StatsPolicy, NodePolicy>::Cbegin() const {
+  return const_iterator(head_, this);
 }
 
-template <typename T>
-typename List<T>::size_type List<T>::Size() const {
+template <typename T, typename StatsPolicy, typename NodePolicy>
+typename List<T, StatsPolicy, NodePolicy>::size_type
+List<T, StatsPolicy, NodePolicy>::Size() const {
   return size_;
 }
 
-template <typename T>
-typename List<T>::size_type List<T>::Max_size() {
+template <typename T, typename StatsPolicy, typename NodePolicy>
+typename List<T, StatsPolicy, NodePolicy>::size_type
+List<T, StatsPolicy, NodePolicy>::Max_size() {
   return std::numeric_limits<size_type>::max() / sizeof(ListNode);
 }
 
-template <typename T>
-void List<T>::Clear() {
+template <typename T, typename StatsPolicy, typename NodePolicy>
+void List<T, StatsPolicy, NodePolicy>::Clear() {
+  if (Defer_clear()) return;
   while (head_ != nullptr) {
     ListNode *tmp = head_;
     head_ = head_->next;
-    delete tmp;
+    Destroy_node(tmp);
   }
   tail_ = nullptr;
   size_ = 0;
 }
 
-template <typename T>
-typename List<T>::iterator List<T>::Insert(iterator pos,
-                                           const_reference value) {
+template <typename T, typename StatsPolicy, typename NodePolicy>
+typename List<T, StatsPolicy, NodePolicy>::size_type
+List<T, StatsPolicy, NodePolicy>::Clear_incremental(size_type budget) {
+  for (; budget > 0 && head_ != nullptr; --budget) {
+    ListNode *tmp = head_;
+    head_ = head_->next;
+    Destroy_node(tmp);
+    size_--;
+  }
+  if (head_) {
+    head_->prev = nullptr;
+  } else {
+    tail_ = nullptr;
+  }
+  return size_;
+}
+
+template <typename T, typename StatsPolicy, typename NodePolicy>
+typename List<T, StatsPolicy, NodePolicy>::iterator
+List<T, StatsPolicy, NodePolicy>::Insert(iterator pos, const_reference value) {
   iterator result;
 
   if (pos == End()) {
     Push_back(value);
-    result = iterator(tail_);
+    result = iterator(tail_, this);
   } else {
     ListNode *current = pos.ptr_;
-    ListNode *new_node = new ListNode(value, current, current->prev);
+    ListNode *new_node = Create_node(value, current, current->prev);
 
     if (current->prev) {
       current->prev->next = new_node;
@@ -118,12 +202,13 @@ typename List<T>::iterator List<T>::Insert(iterator pos,
     current->prev = new_node;
 
     size_++;
-    result = iterator(new_node);
+    stats_.On_push(size_);
+    result = iterator(new_node, this);
   }
   return result;
 }
-template <typename T>
-void List<T>::Reverse() {
+template <typename T, typename StatsPolicy, typename NodePolicy>
+void List<T, StatsPolicy, NodePolicy>::Reverse() {
   ListNode *current = head_;
   while (current) {
     std::swap(current->prev, current->next);
@@ -131,8 +216,8 @@ void List<T>::Reverse() {
   }
   std::swap(head_, tail_);
 }
-template <typename T>
-void List<T>::Erase(iterator pos) {
+template <typename T, typename StatsPolicy, typename NodePolicy>
+void List<T, StatsPolicy, NodePolicy>::Erase(iterator pos) {
   if (pos == End() || !pos.ptr_) {
     throw std::out_of_range("Cannot erase at end iterator");
   }
@@ -148,13 +233,14 @@ void List<T>::Erase(iterator pos) {
     prev->next = next;
     next->prev = prev;
 
-    delete current;
+    Destroy_node(current);
     size_--;
+    stats_.On_pop();
   }
 }
 
-template <typename T>
-void List<T>::Pop_back() {
+template <typename T, typename StatsPolicy, typename NodePolicy>
+void List<T, StatsPolicy, NodePolicy>::Pop_back() {
   if (Empty()) throw std::out_of_range("List is empty");
 
   ListNode *old_tail = tail_;
@@ -164,12 +250,13 @@ void List<T>::Pop_back() {
   } else {
     head_ = nullptr;
   }
-  delete old_tail;
+  Destroy_node(old_tail);
   size_--;
+  stats_.On_pop();
 }
 
-template <typename T>
-void List<T>::Pop_front() {
+template <typename T, typename StatsPolicy, typename NodePolicy>
+void List<T, StatsPolicy, NodePolicy>::Pop_front() {
   if (Empty()) throw std::out_of_range("List is empty");
 
   ListNode *old_head = head_;
@@ -179,13 +266,23 @@ void List<T>::Pop_front() {
   } else {
     tail_ = nullptr;
   }
-  delete old_head;
+  Destroy_node(old_head);
   size_--;
+  stats_.On_pop();
 }
 
-template <typename T>
-void List<T>::Push_back(const_reference value) {
-  ListNode *new_node = new ListNode(value);
+template <typename T, typename StatsPolicy, typename NodePolicy>
+void List<T, StatsPolicy, NodePolicy>::Push_back(const_reference value) {
+  Link_back(Create_node(value));
+}
+
+template <typename T, typename StatsPolicy, typename NodePolicy>
+void List<T, StatsPolicy, NodePolicy>::Push_back(value_type &&value) {
+  Link_back(Create_node(std::move(value)));
+}
+
+template <typename T, typename StatsPolicy, typename NodePolicy>
+void List<T, StatsPolicy, NodePolicy>::Link_back(ListNode *new_node) {
   if (Empty()) {
     head_ = tail_ = new_node;
   } else {
@@ -194,11 +291,12 @@ void List<T>::Push_back(const_reference value) {
     tail_ = new_node;
   }
   size_++;
+  stats_.On_push(size_);
 }
 
-template <typename T>
-void List<T>::Push_front(const_reference value) {
-  ListNode *new_node = new ListNode(value);
+template <typename T, typename StatsPolicy, typename NodePolicy>
+void List<T, StatsPolicy, NodePolicy>::Push_front(const_reference value) {
+  ListNode *new_node = Create_node(value);
   if (Empty()) {
     head_ = tail_ = new_node;
   } else {
@@ -207,17 +305,19 @@ void List<T>::Push_front(const_reference value) {
     head_ = new_node;
   }
   size_++;
+  stats_.On_push(size_);
 }
 
-template <typename T>
-void List<T>::Swap(List &other) {
+template <typename T, typename StatsPolicy, typename NodePolicy>
+void List<T, StatsPolicy, NodePolicy>::Swap(List &other) {
   std::swap(head_, other.head_);
   std::swap(tail_, other.tail_);
   std::swap(size_, other.size_);
+  if constexpr (kArena) std::swap(nodes_, other.nodes_);
 }
 
-template <typename T>
-void List<T>::Merge(List &other) {
+template <typename T, typename StatsPolicy, typename NodePolicy>
+void List<T, StatsPolicy, NodePolicy>::Merge(List &other) {
   if (!other.Empty() && this != &other) {
     ListNode dummy;
     ListNode *current = &dummy;
@@ -249,14 +349,15 @@ void List<T>::Merge(List &other) {
 
     tail_ = (p1) ? tail_ : other.tail_;
     size_ += other.size_;
+    stats_.On_merge(size_);
 
     other.head_ = other.tail_ = nullptr;
     other.size_ = 0;
   }
 }
 
-template <typename T>
-void List<T>::Splice(iterator pos, List &other) {
+template <typename T, typename StatsPolicy, typename NodePolicy>
+void List<T, StatsPolicy, NodePolicy>::Splice(iterator pos, List &other) {
   if (!other.Empty()) {
     ListNode *other_head = other.head_;
     ListNode *other_tail = other.tail_;
@@ -279,20 +380,43 @@ void List<T>::Splice(iterator pos, List &other) {
 
     other_tail->next = next_node;
     size_ += other.size_;
+    stats_.On_splice(size_);
 
     other.head_ = other.tail_ = nullptr;
     other.size_ = 0;
   }
 }
 
-template <typename T>
-void List<T>::Unique() {
+template <typename T, typename StatsPolicy, typename NodePolicy>
+void List<T, StatsPolicy, NodePolicy>::Splice(iterator pos, List &other,
+                                              iterator it) {
+  ListNode *node = it.ptr_;
+  if (!node) throw std::out_of_range("Cannot splice at end iterator");
+
+  if (node != pos.ptr_ && (this != &other || node->next != pos.ptr_)) {
+    (node->prev ? node->prev->next : other.head_) = node->next;
+    (node->next ? node->next->prev : other.tail_) = node->prev;
+    other.size_--;
+
+    ListNode *next_node = pos.ptr_;
+    ListNode *prev_node = next_node ? next_node->prev : tail_;
+    node->prev = prev_node;
+    node->next = next_node;
+    (prev_node ? prev_node->next : head_) = node;
+    (next_node ? next_node->prev : tail_) = node;
+    size_++;
+    stats_.On_splice(size_);
+  }
+}
+
+template <typename T, typename StatsPolicy, typename NodePolicy>
+void List<T, StatsPolicy, NodePolicy>::Unique() {
   for (ListNode *current = head_; current && current->next;) {
     if (current->value == current->next->value) {
       ListNode *to_delete = current->next;
       current->next = to_delete->next;
       to_delete->next ? to_delete->next->prev = current : tail_ = current;
-      delete to_delete;
+      Destroy_node(to_delete);
       size_--;
     } else {
       current = current->next;
@@ -300,8 +424,20 @@ void List<T>::Unique() {
   }
 }
 
-template <typename T>
-void List<T>::Sort() {
+template <typename T, typename StatsPolicy, typename NodePolicy>
+void List<T, StatsPolicy, NodePolicy>::Sort() {
+  if constexpr (StatsPolicy::kEnabled) {
+    const auto start = std::chrono::steady_clock::now();
+    Sort_impl();
+    stats_.On_sort(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start));
+  } else {
+    Sort_impl();
+  }
+}
+
+template <typename T, typename StatsPolicy, typename NodePolicy>
+void List<T, StatsPolicy, NodePolicy>::Sort_impl() {
   if (size_ >= 2) {
     List left;
     List right;
@@ -311,14 +447,16 @@ void List<T>::Sort() {
     for (size_t i = 0; i < mid; ++i) {
       left.Push_back(current->value);
       current = current->next;
+      detail::Prefetch_next(current);
     }
     while (current) {
       right.Push_back(current->value);
       current = current->next;
+      detail::Prefetch_next(current);
     }
 
-    left.Sort();
-    right.Sort();
+    left.Sort_impl();
+    right.Sort_impl();
 
     Clear();
     ListNode *p1 = left.head_;
@@ -328,9 +466,11 @@ void List<T>::Sort() {
       if (p1->value < p2->value) {
         Push_back(p1->value);
         p1 = p1->next;
+        detail::Prefetch_next(p1);
       } else {
         Push_back(p2->value);
         p2 = p2->next;
+        detail::Prefetch_next(p2);
       }
     }
 
@@ -345,27 +485,466 @@ void List<T>::Sort() {
   }
 }
 
-template <typename T>
+template <typename T, typename StatsPolicy, typename NodePolicy>
+List<T, StatsPolicy, NodePolicy>
+List<T, StatsPolicy, NodePolicy>::Split(iterator pos) {
+  size_type count = 0;
+  for (const ListNode *node = pos.ptr_; node; node = node->next) ++count;
+  return Split(pos, count);
+}
+
+template <typename T, typename StatsPolicy, typename NodePolicy>
+List<T, StatsPolicy, NodePolicy>
+List<T, StatsPolicy, NodePolicy>::Split(iterator pos, size_type count) {
+  List rest;
+  if constexpr (kArena) rest.nodes_.reclaimer = nodes_.reclaimer;
+  if (pos.ptr_) {
+    rest.head_ = pos.ptr_;
+    rest.tail_ = tail_;
+    rest.size_ = count;
+    tail_ = pos.ptr_->prev;
+    (tail_ ? tail_->next : head_) = nullptr;
+    pos.ptr_->prev = nullptr;
+    size_ -= count;
+  }
+  return rest;
+}
+
+template <typename T, typename StatsPolicy, typename NodePolicy>
+template <typename Pred>
+void List<T, StatsPolicy, NodePolicy>::Partition_run(PartitionRun &run,
+                                                     Pred &pred) {
+  while (run.count > 0) {
+    ListNode *node = run.first;
+    const bool keep = pred(std::as_const(node->value));
+    run.first = node->next;
+    --run.count;
+    (keep ? run.yes : run.no).Append(node);
+  }
+}
+
+template <typename T, typename StatsPolicy, typename NodePolicy>
+template <typename Pred>
+typename List<T, StatsPolicy, NodePolicy>::iterator
+List<T, StatsPolicy, NodePolicy>::Stable_partition(Pred pred) {
+  PartitionRun run;
+  run.first = head_;
+  run.last = tail_;
+  run.count = size_;
+  try {
+    Partition_run(run, pred);
+  } catch (...) {
+    Chain all = run.yes;
+    all.Append(run.no);
+    run.Unvisited(all);
+    Adopt(all);
+    throw;
+  }
+  ListNode *boundary = run.no.head;
+  run.yes.Append(run.no);
+  Adopt(run.yes);
+  return iterator(boundary, this);
+}
+
+template <typename T, typename StatsPolicy, typename NodePolicy>
+template <typename Pred>
+typename List<T, StatsPolicy, NodePolicy>::iterator
+List<T, StatsPolicy, NodePolicy>::Stable_partition(
+    Pred pred, size_type threads) {
+  // Below this many nodes per thread the spawn costs more than it saves.
+  constexpr size_type kMinChunk = 4096;
+  threads = std::min(threads, size_ / kMinChunk);
+  if (threads <= 1) return Stable_partition(std::move(pred));
+
+  std::vector<PartitionRun> runs(threads);
+  ListNode *node = head_;
+  for (size_type i = 0; i < threads; ++i) {
+    runs[i].first = node;
+    runs[i].count = size_ / threads + (i < size_ % threads ? 1 : 0);
+    for (size_type k = 1; k < runs[i].count; ++k) node = node->next;
+    runs[i].last = node;
+    node = node->next;
+  }
+
+  std::vector<std::exception_ptr> errors(threads);
+  auto work = [&runs, &errors, &pred](size_type i) {
+    try {
+      Partition_run(runs[i], pred);
+    } catch (...) {
+      errors[i] = std::current_exception();
+    }
+  };
+  std::vector<std::thread> workers;
+  workers.reserve(threads - 1);
+  for (size_type i = 1; i < threads; ++i) workers.emplace_back(work, i);
+  work(0);
+  for (auto &worker : workers) worker.join();
+
+  Chain all;
+  for (size_type i = 0; i < threads; ++i) {
+    if (errors[i]) {
+      for (const auto &run : runs) {
+        all.Append(run.yes);
+        all.Append(run.no);
+        run.Unvisited(all);
+      }
+      Adopt(all);
+      std::rethrow_exception(errors[i]);
+    }
+  }
+  for (const auto &run : runs) all.Append(run.yes);
+  ListNode *boundary = nullptr;
+  for (const auto &run : runs) {
+    if (!boundary) boundary = run.no.head;
+    all.Append(run.no);
+  }
+  Adopt(all);
+  return iterator(boundary, this);
+}
+
+template <typename T, typename StatsPolicy, typename NodePolicy>
+typename List<T, StatsPolicy, NodePolicy>::iterator
+List<T, StatsPolicy, NodePolicy>::Rotate(iterator middle) {
+  ListNode *old_head = head_;
+  if (middle.ptr_ && middle.ptr_ != head_) {
+    tail_->next = head_;
+    head_->prev = tail_;
+    head_ = middle.ptr_;
+    tail_ = head_->prev;
+    head_->prev = nullptr;
+    tail_->next = nullptr;
+  }
+  return iterator(old_head, this);
+}
+
+template <typename T, typename StatsPolicy, typename NodePolicy>
+void List<T, StatsPolicy, NodePolicy>::Adopt(const Chain &chain) {
+  head_ = chain.head;
+  tail_ = chain.tail;
+  if (head_) head_->prev = nullptr;
+  if (tail_) tail_->next = nullptr;
+}
+
+template <typename T, typename StatsPolicy, typename NodePolicy>
 template <typename... Args>
-typename List<T>::iterator List<T>::Insert_many(const_iterator pos,
-                                                Args &&...args) {
+typename List<T, StatsPolicy, NodePolicy>::iterator
+List<T, StatsPolicy, NodePolicy>::Insert_many(
+    const_iterator pos, Args &&...args) {
   iterator mutable_pos(pos);
   iterator result = mutable_pos;
   (Insert(mutable_pos, std::forward<Args>(args)), ...);
   return result;
 }
 
-template <typename T>
+template <typename T, typename StatsPolicy, typename NodePolicy>
 template <typename... Args>
-void List<T>::Insert_many_back(Args &&...args) {
+void List<T, StatsPolicy, NodePolicy>::Insert_many_back(Args &&...args) {
   (Push_back(std::forward<Args>(args)), ...);
 }
 
-template <typename T>
+template <typename T, typename StatsPolicy, typename NodePolicy>
 template <typename... Args>
-void List<T>::Insert_many_front(Args &&...args) {
+void List<T, StatsPolicy, NodePolicy>::Insert_many_front(Args &&...args) {
   (Push_front(std::forward<Args>(args)), ...);
 }
+
+template <typename T, typename StatsPolicy, typename NodePolicy>
+void List<T, StatsPolicy, NodePolicy>::Reserve(size_type n)
+  requires kArena
+{
+  if (n > 0) {
+    if (!nodes_.arena) nodes_.arena = new detail::NodeArena<ListNode>;
+    nodes_.arena->Reserve(n);
+  }
+}
+
+template <typename T, typename StatsPolicy, typename NodePolicy>
+void List<T, StatsPolicy, NodePolicy>::Compact()
+  requires kArena
+{
+  if (size_ > 0) {
+    auto *compacted = new detail::NodeArena<ListNode>;
+    compacted->Reserve(size_);
+    const size_type count = size_;
+    ListNode *first = nullptr;
+    ListNode *last = nullptr;
+    auto relocate = [&](ListNode *node) {
+      detail::ArenaTag tag = 0;
+      ListNode *copy = compacted->Create(
+          &tag, std::move_if_noexcept(node->value), nullptr, last);
+      copy->arena_tag = tag;
+      stats_.On_allocate();
+      (last ? last->next : first) = copy;
+      last = copy;
+    };
+
+    if constexpr (std::is_nothrow_move_constructible_v<T>) {
+      // Nothing can throw, so every old node is released as soon as its
+      // value has moved and the fragmented chain is walked only once.
+      while (head_) {
+        ListNode *next = head_->next;
+        detail::Prefetch_next(next);
+        relocate(head_);
+        Destroy_node(head_);
+        head_ = next;
+      }
+    } else {
+      try {
+        for (ListNode *node = head_; node; node = node->next) {
+          detail::Prefetch_next(node);
+          relocate(node);
+        }
+      } catch (...) {
+        while (first) {
+          ListNode *next = first->next;
+          const detail::ArenaTag tag = first->arena_tag;
+          first->~ListNode();
+          compacted->Recycle(first, tag);
+          first = next;
+        }
+        delete compacted;
+        throw;
+      }
+      Clear();
+    }
+
+    delete nodes_.arena;
+    head_ = first;
+    tail_ = last;
+    size_ = count;
+    nodes_.arena = compacted;
+  }
+}
+
+template <typename T, typename StatsPolicy, typename NodePolicy>
+typename List<T, StatsPolicy, NodePolicy>::value_type
+List<T, StatsPolicy, NodePolicy>::Sum() const {
+  value_type total = value_type();
+  For_each_run([&total](const ListNode *first, size_type count) {
+    total = detail::simd::Sum(&first->value, sizeof(ListNode), count, total);
+    return true;
+  });
+  return total;
+}
+
+template <typename T, typename StatsPolicy, typename NodePolicy>
+typename List<T, StatsPolicy, NodePolicy>::value_type
+List<T, StatsPolicy, NodePolicy>::Min() const {
+  if (Empty()) throw std::out_of_range("List is empty");
+  value_type result = head_->value;
+  For_each_run([&result](const ListNode *first, size_type count) {
+    result = detail::simd::Min(&first->value, sizeof(ListNode), count, result);
+    return true;
+  });
+  return result;
+}
+
+template <typename T, typename StatsPolicy, typename NodePolicy>
+typename List<T, StatsPolicy, NodePolicy>::value_type
+List<T, StatsPolicy, NodePolicy>::Max() const {
+  if (Empty()) throw std::out_of_range("List is empty");
+  value_type result = head_->value;
+  For_each_run([&result](const ListNode *first, size_type count) {
+    result = detail::simd::Max(&first->value, sizeof(ListNode), count, result);
+    return true;
+  });
+  return result;
+}
+
+template <typename T, typename StatsPolicy, typename NodePolicy>
+typename List<T, StatsPolicy, NodePolicy>::size_type
+List<T, StatsPolicy, NodePolicy>::Count(const_reference value) const {
+  size_type matches = 0;
+  For_each_run([&](const ListNode *first, size_type count) {
+    matches +=
+        detail::simd::Count(&first->value, sizeof(ListNode), count, value);
+    return true;
+  });
+  return matches;
+}
+
+template <typename T, typename StatsPolicy, typename NodePolicy>
+bool List<T, StatsPolicy, NodePolicy>::Contains(const_reference value) const {
+  return Find_node(value) != nullptr;
+}
+
+template <typename T, typename StatsPolicy, typename NodePolicy>
+typename List<T, StatsPolicy, NodePolicy>::iterator
+List<T, StatsPolicy, NodePolicy>::Find(const_reference value) {
+  return iterator(const_cast<ListNode *>(Find_node(value)), this);
+}
+
+template <typename T, typename StatsPolicy, typename NodePolicy>
+typename List<T, StatsPolicy, NodePolicy>::const_iterator
+List<T, StatsPolicy, NodePolicy>::Find(const_reference value) const {
+  return const_iterator(Find_node(value), this);
+}
+
+template <typename T, typename StatsPolicy, typename NodePolicy>
+const typename List<T, StatsPolicy, NodePolicy>::ListNode *
+List<T, StatsPolicy, NodePolicy>::Find_node(const_reference value) const {
+  const ListNode *found = nullptr;
+  For_each_run([&](const ListNode *first, size_type count) {
+    size_type index =
+        detail::simd::Find(&first->value, sizeof(ListNode), count, value);
+    if (index < count) found = first + index;
+    return found == nullptr;
+  });
+  return found;
+}
+
+// Hands fn every run of nodes that follow each other both in the list and
+// in memory, stopping early once fn returns false. Runs are cut into pieces
+// small enough to still be in L1 when fn reads the values back.
+template <typename T, typename StatsPolicy, typename NodePolicy>
+template <typename Fn>
+void List<T, StatsPolicy, NodePolicy>::For_each_run(Fn fn) const {
+  constexpr size_type kMaxRun = 8192 / sizeof(ListNode) + 1;
+  const ListNode *node = head_;
+  bool more = true;
+  while (node && more) {
+    size_type count = 1;
+    while (count < kMaxRun &&
+           reinterpret_cast<uintptr_t>(node[count - 1].next) ==
+               reinterpret_cast<uintptr_t>(node + count - 1) +
+                   sizeof(ListNode)) {
+      ++count;
+    }
+    more = fn(node, count);
+    node = node[count - 1].next;
+  }
+}
+
+template <typename T, typename StatsPolicy, typename NodePolicy>
+template <typename U>
+typename List<T, StatsPolicy, NodePolicy>::ListNode *
+List<T, StatsPolicy, NodePolicy>::Create_node(
+    U &&value, ListNode *next, ListNode *prev) {
+  ListNode *node = nullptr;
+  if constexpr (kArena) {
+    if (nodes_.arena && nodes_.arena->Available()) {
+      detail::ArenaTag tag = 0;
+      node = nodes_.arena->Create(&tag, std::forward<U>(value), next, prev);
+      node->arena_tag = tag;
+    }
+  }
+  if (!node) node = new ListNode(std::forward<U>(value), next, prev);
+  stats_.On_allocate();
+  return node;
+}
+
+template <typename T, typename StatsPolicy, typename NodePolicy>
+void List<T, StatsPolicy, NodePolicy>::Destroy_node(ListNode *node) {
+  if constexpr (kArena) {
+    const detail::ArenaTag tag = node->arena_tag;
+    if (tag) {
+      node->~ListNode();
+      if (nodes_.arena) {
+        nodes_.arena->Recycle(node, tag);
+      } else {
+        detail::NodeArena<ListNode>::Release(node, tag);
+      }
+      stats_.On_free();
+      return;
+    }
+  }
+  delete node;
+  stats_.On_free();
+}
+
+// With ArenaNodes, large appends take their nodes from contiguous blocks
+// instead of one allocation each. Small appends are not worth a block of
+// their own.
+template <typename T, typename StatsPolicy, typename NodePolicy>
+void List<T, StatsPolicy, NodePolicy>::Reserve_for_append(size_type n) {
+  if constexpr (kArena) {
+    constexpr size_type kMinBlock = 16;
+    const detail::NodeArena<ListNode> *arena = nodes_.arena;
+    const size_type available = arena ? arena->Available() : 0;
+    // Slots freed earlier are used up too, after the reserved ones.
+    const size_type cached = arena ? available - arena->Fresh() : 0;
+    if (n >= available + kMinBlock) Reserve(n - cached);
+  } else {
+    (void)n;
+  }
+}
+
+// Frees `first` and every node after it.
+template <typename T, typename StatsPolicy, typename NodePolicy>
+void List<T, StatsPolicy, NodePolicy>::Truncate(ListNode *first) {
+  tail_ = first->prev;
+  (tail_ ? tail_->next : head_) = nullptr;
+  while (first) {
+    ListNode *next = first->next;
+    Destroy_node(first);
+    first = next;
+    size_--;
+  }
+}
+
+namespace detail {
+// Node chain detached from a List, freed by a NodeReclaimer. Arena nodes go
+// straight back to their blocks; the list's former arena, with the slots it
+// still caches, is deleted once the chain is gone.
+template <typename Node>
+class ListChainJob : public ReclaimJob {
+ public:
+  ListChainJob(Node *head, NodeArena<Node> *arena)
+      : head_(head), arena_(arena) {}
+  ~ListChainJob() override {
+    while (!Reclaim(~size_t{0})) {
+    }
+  }
+
+  bool Reclaim(size_t budget) override {
+    typename NodeArena<Node>::Releaser release;
+    for (; budget > 0 && head_; --budget) {
+      Node *node = head_;
+      head_ = head_->next;
+      const ArenaTag tag = node->arena_tag;
+      if (tag) {
+        node->~Node();
+        release.Add(node, tag);
+      } else {
+        delete node;
+      }
+    }
+    if (!head_) {
+      delete arena_;
+      arena_ = nullptr;
+    }
+    return head_ == nullptr;
+  }
+
+ private:
+  Node *head_;
+  NodeArena<Node> *arena_;
+};
+}  // namespace detail
+
+// Hands the whole chain, and the arena its nodes may live in, to the
+// reclaimer. Short lists are not worth the round trip, and if even the job
+// cannot be allocated the caller simply frees the nodes itself.
+template <typename T, typename StatsPolicy, typename NodePolicy>
+bool List<T, StatsPolicy, NodePolicy>::Defer_clear() {
+  bool deferred = false;
+  if constexpr (kArena) {
+    constexpr size_type kMinDeferred = 64;
+    if (nodes_.reclaimer && size_ >= kMinDeferred) {
+      auto *job = new (std::nothrow)
+          detail::ListChainJob<ListNode>(head_, nodes_.arena);
+      if (job) {
+        stats_.On_free(size_);
+        head_ = tail_ = nullptr;
+        size_ = 0;
+        nodes_.arena = nullptr;
+        nodes_.reclaimer->Submit(job);
+        deferred = true;
+      }
+    }
+  }
+  return deferred;
+}
 }  // namespace s21
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,370 @@
+#ifndef S21_LIST_SIMD_H
+#define S21_LIST_SIMD_H
+
+#include <cstddef>
+#include <type_traits>
+
+#if (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__GNUC__) || defined(__clang__))
+#define S21_SIMD_X86 1
+#include <immintrin.h>
+#endif
+
+namespace s21 {
+namespace detail {
+namespace simd {
+// Kernels over "strided runs": `count` values, the first at `first` and each
+// following one `stride` bytes further. A run of list nodes that sit next to
+// each other in memory (after Reserve or Compact) is exactly that, with the
+// node size as the stride, so the loop no longer waits on a pointer load per
+// element. int and double get hand-written AVX2 gather kernels, selected at
+// run time; every other type, and CPUs without AVX2, use the plain strided
+// loop, which the compiler emits with the baseline SSE2 instruction set.
+
+constexpr size_t kMinVectorRun = 16;
+
+template <typename T>
+inline const T &At(const T *first, size_t stride, size_t index) {
+  return *reinterpret_cast<const T *>(reinterpret_cast<const char *>(first) +
+                                      index * stride);
+}
+
+template <typename T>
+inline const T *Skip(const T *first, size_t stride, size_t count) {
+  return reinterpret_cast<const T *>(reinterpret_cast<const char *>(first) +
+                                     count * stride);
+}
+
+template <typename T>
+T Sum_scalar(const T *first, size_t stride, size_t count, T init) {
+  for (size_t i = 0; i < count; ++i) init = init + At(first, stride, i);
+  return init;
+}
+
+template <typename T>
+T Min_scalar(const T *first, size_t stride, size_t count, T init) {
+  for (size_t i = 0; i < count; ++i) {
+    if (At(first, stride, i) < init) init = At(first, stride, i);
+  }
+  return init;
+}
+
+template <typename T>
+T Max_scalar(const T *first, size_t stride, size_t count, T init) {
+  for (size_t i = 0; i < count; ++i) {
+    if (init < At(first, stride, i)) init = At(first, stride, i);
+  }
+  return init;
+}
+
+template <typename T>
+size_t Count_scalar(const T *first, size_t stride, size_t count,
+                    const T &value) {
+  size_t matches = 0;
+  for (size_t i = 0; i < count; ++i) matches += At(first, stride, i) == value;
+  return matches;
+}
+
+template <typename T>
+size_t Find_scalar(const T *first, size_t stride, size_t count,
+                   const T &value) {
+  size_t index = 0;
+  while (index < count && !(At(first, stride, index) == value)) ++index;
+  return index;
+}
+
+#ifdef S21_SIMD_X86
+inline bool Has_avx2() {
+  static const bool supported = __builtin_cpu_supports("avx2");
+  return supported;
+}
+
+// Gathers use 32-bit byte offsets relative to a moving base pointer, so a
+// run of any length is fine as long as eight strides fit into an int.
+inline bool Gatherable(size_t stride) { return stride <= (1u << 27); }
+
+__attribute__((target("avx2"))) inline __m256i Int_offsets(size_t stride) {
+  const int s = static_cast<int>(stride);
+  return _mm256_setr_epi32(0, s, 2 * s, 3 * s, 4 * s, 5 * s, 6 * s, 7 * s);
+}
+
+__attribute__((target("avx2"))) inline __m128i Double_offsets(size_t stride) {
+  const int s = static_cast<int>(stride);
+  return _mm_setr_epi32(0, s, 2 * s, 3 * s);
+}
+
+// The masked gather with an explicit zero source is what plain
+// _mm256_i32gather_pd expands to, minus GCC's false "uninitialized" warning.
+__attribute__((target("avx2"))) inline __m256d Gather_pd(const char *base,
+                                                         __m128i offsets) {
+  return _mm256_mask_i32gather_pd(
+      _mm256_setzero_pd(), reinterpret_cast<const double *>(base), offsets,
+      _mm256_castsi256_pd(_mm256_set1_epi64x(-1)), 1);
+}
+
+__attribute__((target("avx2"))) inline int Sum_avx2(const int *first,
+                                                    size_t stride,
+                                                    size_t count, int init) {
+  const __m256i offsets = Int_offsets(stride);
+  const char *base = reinterpret_cast<const char *>(first);
+  __m256i acc = _mm256_setzero_si256();
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8, base += 8 * stride) {
+    acc = _mm256_add_epi32(
+        acc, _mm256_i32gather_epi32(reinterpret_cast<const int *>(base),
+                                    offsets, 1));
+  }
+  alignas(32) unsigned lanes[8];
+  _mm256_store_si256(reinterpret_cast<__m256i *>(lanes), acc);
+  unsigned total = static_cast<unsigned>(init);
+  for (unsigned lane : lanes) total += lane;
+  for (; i < count; ++i) total += static_cast<unsigned>(At(first, stride, i));
+  return static_cast<int>(total);
+}
+
+__attribute__((target("avx2"))) inline int Min_avx2(const int *first,
+                                                    size_t stride,
+                                                    size_t count, int init) {
+  const __m256i offsets = Int_offsets(stride);
+  const char *base = reinterpret_cast<const char *>(first);
+  __m256i acc = _mm256_set1_epi32(init);
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8, base += 8 * stride) {
+    acc = _mm256_min_epi32(
+        acc, _mm256_i32gather_epi32(reinterpret_cast<const int *>(base),
+                                    offsets, 1));
+  }
+  alignas(32) int lanes[8];
+  _mm256_store_si256(reinterpret_cast<__m256i *>(lanes), acc);
+  int result = Min_scalar(lanes, sizeof(int), 8, init);
+  return Min_scalar(Skip(first, stride, i), stride, count - i, result);
+}
+
+__attribute__((target("avx2"))) inline int Max_avx2(const int *first,
+                                                    size_t stride,
+                                                    size_t count, int init) {
+  const __m256i offsets = Int_offsets(stride);
+  const char *base = reinterpret_cast<const char *>(first);
+  __m256i acc = _mm256_set1_epi32(init);
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8, base += 8 * stride) {
+    acc = _mm256_max_epi32(
+        acc, _mm256_i32gather_epi32(reinterpret_cast<const int *>(base),
+                                    offsets, 1));
+  }
+  alignas(32) int lanes[8];
+  _mm256_store_si256(reinterpret_cast<__m256i *>(lanes), acc);
+  int result = Max_scalar(lanes, sizeof(int), 8, init);
+  return Max_scalar(Skip(first, stride, i), stride, count - i, result);
+}
+
+__attribute__((target("avx2"))) inline size_t Count_avx2(const int *first,
+                                                         size_t stride,
+                                                         size_t count,
+                                                         int value) {
+  const __m256i offsets = Int_offsets(stride);
+  const __m256i needle = _mm256_set1_epi32(value);
+  const char *base = reinterpret_cast<const char *>(first);
+  size_t matches = 0;
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8, base += 8 * stride) {
+    const __m256i values = _mm256_i32gather_epi32(
+        reinterpret_cast<const int *>(base), offsets, 1);
+    const int mask = _mm256_movemask_ps(
+        _mm256_castsi256_ps(_mm256_cmpeq_epi32(values, needle)));
+    matches += static_cast<size_t>(__builtin_popcount(mask));
+  }
+  return matches + Count_scalar(Skip(first, stride, i), stride, count - i,
+                                value);
+}
+
+__attribute__((target("avx2"))) inline size_t Find_avx2(const int *first,
+                                                        size_t stride,
+                                                        size_t count,
+                                                        int value) {
+  const __m256i offsets = Int_offsets(stride);
+  const __m256i needle = _mm256_set1_epi32(value);
+  const char *base = reinterpret_cast<const char *>(first);
+  size_t i = 0;
+  int mask = 0;
+  for (; i + 8 <= count && !mask; i += 8, base += 8 * stride) {
+    const __m256i values = _mm256_i32gather_epi32(
+        reinterpret_cast<const int *>(base), offsets, 1);
+    mask = _mm256_movemask_ps(
+        _mm256_castsi256_ps(_mm256_cmpeq_epi32(values, needle)));
+  }
+  return mask ? i - 8 + static_cast<size_t>(__builtin_ctz(mask))
+              : i + Find_scalar(Skip(first, stride, i), stride, count - i,
+                                value);
+}
+
+__attribute__((target("avx2"))) inline double Sum_avx2(const double *first,
+                                                       size_t stride,
+                                                       size_t count,
+                                                       double init) {
+  const __m128i offsets = Double_offsets(stride);
+  const char *base = reinterpret_cast<const char *>(first);
+  __m256d acc = _mm256_setzero_pd();
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4, base += 4 * stride) {
+    acc = _mm256_add_pd(acc, Gather_pd(base, offsets));
+  }
+  alignas(32) double lanes[4];
+  _mm256_store_pd(lanes, acc);
+  init += (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+  return Sum_scalar(Skip(first, stride, i), stride, count - i, init);
+}
+
+__attribute__((target("avx2"))) inline double Min_avx2(const double *first,
+                                                       size_t stride,
+                                                       size_t count,
+                                                       double init) {
+  const __m128i offsets = Double_offsets(stride);
+  const char *base = reinterpret_cast<const char *>(first);
+  __m256d acc = _mm256_set1_pd(init);
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4, base += 4 * stride) {
+    acc = _mm256_min_pd(Gather_pd(base, offsets), acc);
+  }
+  alignas(32) double lanes[4];
+  _mm256_store_pd(lanes, acc);
+  double result = Min_scalar(lanes, sizeof(double), 4, init);
+  return Min_scalar(Skip(first, stride, i), stride, count - i, result);
+}
+
+__attribute__((target("avx2"))) inline double Max_avx2(const double *first,
+                                                       size_t stride,
+                                                       size_t count,
+                                                       double init) {
+  const __m128i offsets = Double_offsets(stride);
+  const char *base = reinterpret_cast<const char *>(first);
+  __m256d acc = _mm256_set1_pd(init);
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4, base += 4 * stride) {
+    acc = _mm256_max_pd(Gather_pd(base, offsets), acc);
+  }
+  alignas(32) double lanes[4];
+  _mm256_store_pd(lanes, acc);
+  double result = Max_scalar(lanes, sizeof(double), 4, init);
+  return Max_scalar(Skip(first, stride, i), stride, count - i, result);
+}
+
+__attribute__((target("avx2"))) inline size_t Count_avx2(const double *first,
+                                                         size_t stride,
+                                                         size_t count,
+                                                         double value) {
+  const __m128i offsets = Double_offsets(stride);
+  const __m256d needle = _mm256_set1_pd(value);
+  const char *base = reinterpret_cast<const char *>(first);
+  size_t matches = 0;
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4, base += 4 * stride) {
+    const __m256d values = Gather_pd(base, offsets);
+    const int mask =
+        _mm256_movemask_pd(_mm256_cmp_pd(values, needle, _CMP_EQ_OQ));
+    matches += static_cast<size_t>(__builtin_popcount(mask));
+  }
+  return matches + Count_scalar(Skip(first, stride, i), stride, count - i,
+                                value);
+}
+
+__attribute__((target("avx2"))) inline size_t Find_avx2(const double *first,
+                                                        size_t stride,
+                                                        size_t count,
+                                                        double value) {
+  const __m128i offsets = Double_offsets(stride);
+  const __m256d needle = _mm256_set1_pd(value);
+  const char *base = reinterpret_cast<const char *>(first);
+  size_t i = 0;
+  int mask = 0;
+  for (; i + 4 <= count && !mask; i += 4, base += 4 * stride) {
+    const __m256d values = Gather_pd(base, offsets);
+    mask = _mm256_movemask_pd(_mm256_cmp_pd(values, needle, _CMP_EQ_OQ));
+  }
+  return mask ? i - 4 + static_cast<size_t>(__builtin_ctz(mask))
+              : i + Find_scalar(Skip(first, stride, i), stride, count - i,
+                                value);
+}
+#endif
+
+template <typename T>
+inline constexpr bool kHasVectorKernel =
+    std::is_same_v<T, int> || std::is_same_v<T, double>;
+
+template <typename T>
+inline bool Use_vector(size_t stride, size_t count) {
+#ifdef S21_SIMD_X86
+  if constexpr (kHasVectorKernel<T>) {
+    return count >= kMinVectorRun && Gatherable(stride) && Has_avx2();
+  }
+#endif
+  (void)stride;
+  (void)count;
+  return false;
+}
+
+template <typename T>
+T Sum(const T *first, size_t stride, size_t count, T init) {
+#ifdef S21_SIMD_X86
+  if constexpr (kHasVectorKernel<T>) {
+    if (Use_vector<T>(stride, count)) {
+      return Sum_avx2(first, stride, count, init);
+    }
+  }
+#endif
+  return Sum_scalar(first, stride, count, init);
+}
+
+template <typename T>
+T Min(const T *first, size_t stride, size_t count, T init) {
+#ifdef S21_SIMD_X86
+  if constexpr (kHasVectorKernel<T>) {
+    if (Use_vector<T>(stride, count)) {
+      return Min_avx2(first, stride, count, init);
+    }
+  }
+#endif
+  return Min_scalar(first, stride, count, init);
+}
+
+template <typename T>
+T Max(const T *first, size_t stride, size_t count, T init) {
+#ifdef S21_SIMD_X86
+  if constexpr (kHasVectorKernel<T>) {
+    if (Use_vector<T>(stride, count)) {
+      return Max_avx2(first, stride, count, init);
+    }
+  }
+#endif
+  return Max_scalar(first, stride, count, init);
+}
+
+template <typename T>
+size_t Count(const T *first, size_t stride, size_t count, const T &value) {
+#ifdef S21_SIMD_X86
+  if constexpr (kHasVectorKernel<T>) {
+    if (Use_vector<T>(stride, count)) {
+      return Count_avx2(first, stride, count, value);
+    }
+  }
+#endif
+  return Count_scalar(first, stride, count, value);
+}
+
+// Index of the first element equal to `value`, or `count` if there is none.
+template <typename T>
+size_t Find(const T *first, size_t stride, size_t count, const T &value) {
+#ifdef S21_SIMD_X86
+  if constexpr (kHasVectorKernel<T>) {
+    if (Use_vector<T>(stride, count)) {
+      return Find_avx2(first, stride, count, value);
+    }
+  }
+#endif
+  return Find_scalar(first, stride, count, value);
+}
+}  // namespace simd
+}  // namespace detail
+}  // namespace s21
+
+#endif
@@ -0,0 +1,74 @@
+#ifndef S21_LIST_STATS_H
+#define S21_LIST_STATS_H
+
+#include <chrono>
+#include <cstddef>
+
+namespace s21 {
+// Snapshot of the counters collected by a stats policy. All fields stay zero
+// when the container is instantiated with NoStats.
+struct ContainerStats {
+  size_t allocations = 0;
+  size_t frees = 0;
+  size_t pushes = 0;
+  size_t pops = 0;
+  size_t max_size = 0;
+  size_t splice_calls = 0;
+  size_t merge_calls = 0;
+  size_t sort_calls = 0;
+  std::chrono::nanoseconds sort_time{0};
+};
+
+// Default policy: every hook is an empty inline function and the object has
+// no state, so a container stored with [[no_unique_address]] pays nothing.
+struct NoStats {
+  static constexpr bool kEnabled = false;
+
+  void On_allocate() noexcept {}
+  void On_free(size_t = 1) noexcept {}
+  void On_push(size_t) noexcept {}
+  void On_pop() noexcept {}
+  void On_splice(size_t) noexcept {}
+  void On_merge(size_t) noexcept {}
+  void On_sort(std::chrono::nanoseconds) noexcept {}
+  ContainerStats Snapshot() const noexcept { return ContainerStats(); }
+};
+
+// Plain counters for single-threaded use, same as the containers themselves.
+class CountingStats {
+ public:
+  static constexpr bool kEnabled = true;
+
+  void On_allocate() noexcept { ++stats_.allocations; }
+  // `count` > 1 reports a whole chain at once, e.g. one handed to a
+  // NodeReclaimer, without a loop on the caller's thread.
+  void On_free(size_t count = 1) noexcept { stats_.frees += count; }
+  void On_push(size_t new_size) noexcept {
+    ++stats_.pushes;
+    Track_size(new_size);
+  }
+  void On_pop() noexcept { ++stats_.pops; }
+  void On_splice(size_t new_size) noexcept {
+    ++stats_.splice_calls;
+    Track_size(new_size);
+  }
+  void On_merge(size_t new_size) noexcept {
+    ++stats_.merge_calls;
+    Track_size(new_size);
+  }
+  void On_sort(std::chrono::nanoseconds elapsed) noexcept {
+    ++stats_.sort_calls;
+    stats_.sort_time += elapsed;
+  }
+  ContainerStats Snapshot() const noexcept { return stats_; }
+
+ private:
+  void Track_size(size_t size) noexcept {
+    if (size > stats_.max_size) stats_.max_size = size;
+  }
+
+  ContainerStats stats_;
+};
+}  // namespace s21
+
+#endif
@@ -0,0 +1,246 @@
+#ifndef S21_NODE_ARENA_H
+#define S21_NODE_ARENA_H
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+namespace s21 {
+namespace detail {
+// Stored in every node by the containers that use NodeArena: the base-2 log
+// of the alignment of the block the node was carved from, or 0 for a node
+// that does not come from an arena. Blocks are aligned to their size
+// rounded up to a power of two and start with their header, so the tag is
+// all it takes to get from a node to its block.
+using ArenaTag = uint8_t;
+
+inline std::atomic<size_t> &Arena_block_counter() {
+  static std::atomic<size_t> blocks{0};
+  return blocks;
+}
+// Arena blocks currently allocated, across all node types.
+inline size_t Arena_blocks() {
+  return Arena_block_counter().load(std::memory_order_relaxed);
+}
+
+// Upper bound for one arena block. Blocks are aligned to their size rounded
+// up to a power of two, so without it a single large Reserve or Compact
+// could ask the allocator for twice its size at a huge alignment.
+inline constexpr size_t kArenaMaxBlockBytes = size_t{1} << 20;
+
+// Contiguous node storage for linked containers. Reserved slots are handed
+// out in address order, block after block, before any freed slot is reused,
+// so nodes created one after another end up next to each other in memory.
+// Blocks hold at most kArenaMaxBlockBytes; larger reservations are chained.
+//
+// Nodes migrate between containers (Splice, Merge, ...), so a block can hold
+// nodes of several containers at once. Each block therefore counts its own
+// slots that have not been given back, and is returned to the system along
+// with the last of them. A container frees a node through its own arena
+// with Recycle, or with the static Release when it has none; either way
+// that is O(1) and neither side keeps track of the other's blocks. Only the
+// arena that carved a block caches its freed slots for reuse; slots of
+// other arenas' blocks go straight back to their block.
+template <typename Node>
+class NodeArena {
+  struct Block;
+
+ public:
+  NodeArena() : id_(Next_id()) {}
+  NodeArena(const NodeArena &) = delete;
+  NodeArena &operator=(const NodeArena &) = delete;
+  ~NodeArena() {
+    while (bump_) {
+      Block *next = bump_->next;
+      Unref(bump_, bump_->capacity - bump_->used + 1);
+      bump_ = next;
+    }
+    Releaser release;
+    while (free_) {
+      FreeSlot *slot = free_;
+      free_ = slot->next;
+      release.Add(slot->block);
+    }
+  }
+
+  // Raw storage for one node, or nullptr when nothing is reserved. `*tag`
+  // receives the value the node has to carry (see ArenaTag).
+  void *Allocate(ArenaTag *tag) {
+    void *slot = nullptr;
+    if (bump_) {
+      slot = bump_->Slots() + bump_->used++;
+      *tag = bump_->tag;
+      --fresh_;
+      if (bump_->used == bump_->capacity) Retire_bump();
+    } else if (free_) {
+      slot = free_;
+      *tag = free_->block->tag;
+      free_ = free_->next;
+      --free_count_;
+    }
+    return slot;
+  }
+
+  // Allocate plus construction of the node in the slot, for use while
+  // Available() is not zero. If the constructor throws, the slot goes back
+  // to the arena before the exception propagates.
+  template <typename... Args>
+  Node *Create(ArenaTag *tag, Args &&...args) {
+    void *slot = Allocate(tag);
+    try {
+      return ::new (slot) Node(std::forward<Args>(args)...);
+    } catch (...) {
+      Recycle(slot, *tag);
+      throw;
+    }
+  }
+
+  // Takes back the storage of an already destroyed node carved from any
+  // arena. Slots of this arena's own blocks are kept for reuse, the others
+  // go back to their block.
+  void Recycle(void *slot, ArenaTag tag) {
+    Block *block = Block::Of(slot, tag);
+    if (block->owner == id_) {
+      free_ = ::new (slot) FreeSlot{free_, block};
+      ++free_count_;
+    } else {
+      Unref(block, 1);
+    }
+  }
+  // Recycle for callers without an arena of their own.
+  static void Release(void *slot, ArenaTag tag) {
+    Unref(Block::Of(slot, tag), 1);
+  }
+
+  // Release for a whole chain of nodes: counters are updated once per run
+  // of consecutive slots from the same block instead of once per slot.
+  class Releaser {
+   public:
+    Releaser() = default;
+    Releaser(const Releaser &) = delete;
+    Releaser &operator=(const Releaser &) = delete;
+    ~Releaser() { Flush(); }
+
+    void Add(void *slot, ArenaTag tag) { Add(Block::Of(slot, tag)); }
+
+   private:
+    friend class NodeArena;
+    void Add(Block *block) {
+      if (block != block_) {
+        Flush();
+        block_ = block;
+      }
+      ++count_;
+    }
+    void Flush() {
+      if (count_) Unref(block_, count_);
+      count_ = 0;
+    }
+
+    Block *block_ = nullptr;
+    size_t count_ = 0;
+  };
+
+  // Guarantees that the next `count` allocations come from reserved blocks,
+  // each of them one contiguous run of slots.
+  void Reserve(size_t count) {
+    while (fresh_ < count) {
+      Block *block = New_block(std::min(count - fresh_, kMaxSlots));
+      (last_ ? last_->next : bump_) = block;
+      last_ = block;
+      fresh_ += block->capacity;
+    }
+  }
+
+  // Reserved slots not handed out yet.
+  size_t Fresh() const { return fresh_; }
+  // Slots that Allocate can hand out without a new Reserve.
+  size_t Available() const { return fresh_ + free_count_; }
+
+ private:
+  // Header at the start of every block, followed by the slots.
+  struct Block {
+    Block(uint64_t owner_id, size_t count, ArenaTag block_tag)
+        : refs(count + 1), owner(owner_id), capacity(count), used(0),
+          tag(block_tag) {}
+
+    static Block *Of(const void *slot, ArenaTag tag) {
+      return reinterpret_cast<Block *>(reinterpret_cast<uintptr_t>(slot) &
+                                       ~((uintptr_t{1} << tag) - 1));
+    }
+    Node *Slots() {
+      return reinterpret_cast<Node *>(reinterpret_cast<char *>(this) +
+                                      kHeader);
+    }
+
+    // Slots not given back yet, whether live, cached by the owner or never
+    // handed out, plus one until its owner has handed out the last slot.
+    std::atomic<size_t> refs;
+    const uint64_t owner;
+    const size_t capacity;
+    size_t used;
+    // Next reserved block, while this one still has fresh slots.
+    Block *next = nullptr;
+    const ArenaTag tag;
+  };
+  struct FreeSlot {
+    FreeSlot *next;
+    Block *block;
+  };
+  static_assert(sizeof(Node) >= sizeof(FreeSlot));
+  static constexpr size_t kHeader =
+      (sizeof(Block) + alignof(Node) - 1) / alignof(Node) * alignof(Node);
+  static constexpr size_t kMaxSlots =
+      std::max<size_t>(1, (kArenaMaxBlockBytes - kHeader) / sizeof(Node));
+
+  // Arenas compare ids rather than addresses, so a new arena at a freed
+  // one's address does not take over its blocks.
+  static uint64_t Next_id() {
+    static std::atomic<uint64_t> next{0};
+    return next.fetch_add(1, std::memory_order_relaxed) + 1;
+  }
+
+  // Only `bytes` are allocated; the rest of the alignment is never touched.
+  Block *New_block(size_t count) {
+    const size_t bytes = kHeader + count * sizeof(Node);
+    const size_t align = std::bit_ceil(std::max(bytes, alignof(Block)));
+    void *memory = ::operator new(bytes, std::align_val_t(align));
+    Arena_block_counter().fetch_add(1, std::memory_order_relaxed);
+    return ::new (memory)
+        Block(id_, count, static_cast<ArenaTag>(std::countr_zero(align)));
+  }
+
+  static void Unref(Block *block, size_t count) {
+    if (block->refs.fetch_sub(count, std::memory_order_acq_rel) == count) {
+      const size_t align = size_t{1} << block->tag;
+      block->~Block();
+      ::operator delete(static_cast<void *>(block), std::align_val_t(align));
+      Arena_block_counter().fetch_sub(1, std::memory_order_relaxed);
+    }
+  }
+
+  // The bump block is used up: drop its hold and move on to the next
+  // reserved one.
+  void Retire_bump() {
+    Block *next = bump_->next;
+    if (!next) last_ = nullptr;
+    Unref(bump_, 1);
+    bump_ = next;
+  }
+
+  const uint64_t id_;
+  // Reserved blocks with fresh slots, in the order they are handed out.
+  Block *bump_ = nullptr;
+  Block *last_ = nullptr;
+  size_t fresh_ = 0;
+  FreeSlot *free_ = nullptr;
+  size_t free_count_ = 0;
+};
+}  // namespace detail
+}  // namespace s21
+
+#endif
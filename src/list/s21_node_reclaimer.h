@@ -0,0 +1,125 @@
+#ifndef S21_NODE_RECLAIMER_H
+#define S21_NODE_RECLAIMER_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+
+namespace s21 {
+namespace detail {
+// A detached chain of nodes waiting to be freed, along with whatever the
+// chain needs to free itself.
+class ReclaimJob {
+ public:
+  virtual ~ReclaimJob() = default;
+  // Frees at most `budget` nodes. Returns true once nothing is left.
+  virtual bool Reclaim(size_t budget) = 0;
+
+ private:
+  friend class ReclaimQueue;
+  ReclaimJob *next_ = nullptr;
+};
+
+// Intrusive FIFO of jobs, so handing a chain over never allocates.
+class ReclaimQueue {
+ public:
+  bool Empty() const { return head_ == nullptr; }
+  void Push(ReclaimJob *job) {
+    job->next_ = nullptr;
+    (tail_ ? tail_->next_ : head_) = job;
+    tail_ = job;
+  }
+  ReclaimJob *Pop() {
+    ReclaimJob *job = head_;
+    head_ = job->next_;
+    if (!head_) tail_ = nullptr;
+    return job;
+  }
+
+ private:
+  ReclaimJob *head_ = nullptr;
+  ReclaimJob *tail_ = nullptr;
+};
+}  // namespace detail
+
+// Background thread that frees node chains detached by List::Clear() and
+// ~List() when a list has been given this reclaimer (List::Set_reclaimer).
+// Chains are freed round robin, at most `budget` nodes per step, with an
+// optional pause between steps so teardown never monopolizes a core.
+// Must outlive every list that uses it; the destructor finishes all
+// pending work before joining the thread.
+class NodeReclaimer {
+ public:
+  explicit NodeReclaimer(
+      size_t budget = 4096,
+      std::chrono::microseconds pause = std::chrono::microseconds(0))
+      : budget_(budget ? budget : 1), pause_(pause), thread_([this] {
+          Work();
+        }) {}
+  NodeReclaimer(const NodeReclaimer &) = delete;
+  NodeReclaimer &operator=(const NodeReclaimer &) = delete;
+  ~NodeReclaimer() {
+    {
+      std::lock_guard<std::mutex> guard(lock_);
+      stopping_ = true;
+    }
+    wakeup_.notify_all();
+    thread_.join();
+  }
+
+  void Submit(detail::ReclaimJob *job) {
+    {
+      std::lock_guard<std::mutex> guard(lock_);
+      jobs_.Push(job);
+      ++pending_;
+    }
+    wakeup_.notify_all();
+  }
+
+  // Blocks until every chain submitted so far has been freed.
+  void Drain() {
+    std::unique_lock<std::mutex> guard(lock_);
+    idle_.wait(guard, [this] { return pending_ == 0; });
+  }
+
+  // Chains not yet completely freed.
+  size_t Pending() const {
+    std::lock_guard<std::mutex> guard(lock_);
+    return pending_;
+  }
+
+ private:
+  void Work() {
+    std::unique_lock<std::mutex> guard(lock_);
+    while (true) {
+      wakeup_.wait(guard, [this] { return stopping_ || !jobs_.Empty(); });
+      if (jobs_.Empty()) break;
+      detail::ReclaimJob *job = jobs_.Pop();
+      guard.unlock();
+      const bool done = job->Reclaim(budget_);
+      if (done) delete job;
+      if (pause_.count() > 0) std::this_thread::sleep_for(pause_);
+      guard.lock();
+      if (!done) {
+        jobs_.Push(job);
+      } else if (--pending_ == 0) {
+        idle_.notify_all();
+      }
+    }
+  }
+
+  const size_t budget_;
+  const std::chrono::microseconds pause_;
+  mutable std::mutex lock_;
+  std::condition_variable wakeup_;
+  std::condition_variable idle_;
+  detail::ReclaimQueue jobs_;
+  size_t pending_ = 0;
+  bool stopping_ = false;
+  std::thread thread_;
+};
+}  // namespace s21
+
+#endif
@@ -0,0 +1,325 @@
+#ifndef S21_SNAPSHOT_LIST_H
+#define S21_SNAPSHOT_LIST_H
+
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_list_stats.h"
+
+namespace s21 {
+template <typename T>
+class SnapshotListView;
+
+namespace detail {
+// Fixed-size block of elements chained into a persistent FIFO. Slots are
+// constructed in order and never assigned or destroyed individually: the
+// list appends past the last constructed slot and pops by moving its own
+// begin index, so a view that remembers its own [begin, end) range keeps
+// seeing the same elements for as long as it holds the chain.
+template <typename T>
+struct SnapshotSegment {
+  static constexpr size_t kCapacity =
+      std::max<size_t>(4, 1024 / sizeof(T));
+
+  SnapshotSegment() = default;
+  SnapshotSegment(const SnapshotSegment &) = delete;
+  SnapshotSegment &operator=(const SnapshotSegment &) = delete;
+  ~SnapshotSegment() {
+    for (size_t i = 0; i < used; ++i) At(i).~T();
+  }
+
+  T &At(size_t i) { return std::launder(reinterpret_cast<T *>(storage))[i]; }
+  const T &At(size_t i) const {
+    return std::launder(reinterpret_cast<const T *>(storage))[i];
+  }
+
+  alignas(T) unsigned char storage[sizeof(T) * kCapacity];
+  // Constructed slots. Only the owning SnapshotList writes it.
+  size_t used = 0;
+  std::shared_ptr<SnapshotSegment> next;
+};
+
+// Drops a chain reference without recursing through every shared_ptr
+// destructor: segments we own alone are unlinked one at a time.
+template <typename T>
+void Release_chain(std::shared_ptr<SnapshotSegment<T>> &head) {
+  while (head && head.use_count() == 1) {
+    std::shared_ptr<SnapshotSegment<T>> next = std::move(head->next);
+    head = std::move(next);
+  }
+  head.reset();
+}
+
+template <typename T>
+class SnapshotIterator {
+ public:
+  using value_type = T;
+  using reference = const T &;
+  using pointer = const T *;
+  using difference_type = std::ptrdiff_t;
+  using iterator_category = std::forward_iterator_tag;
+
+  SnapshotIterator() = default;
+  SnapshotIterator(const SnapshotSegment<T> *segment, size_t index,
+                   const SnapshotSegment<T> *last)
+      : segment_(segment), index_(index), last_(last) {}
+
+  reference operator*() const {
+    if (!segment_) throw std::out_of_range("Iterator dereference null pointer");
+    return segment_->At(index_);
+  }
+  pointer operator->() const { return &**this; }
+  // Never reads past `last_`: the source list may be linking new segments
+  // behind it concurrently.
+  SnapshotIterator &operator++() {
+    if (segment_ && ++index_ == SnapshotSegment<T>::kCapacity &&
+        segment_ != last_) {
+      segment_ = segment_->next.get();
+      index_ = 0;
+    }
+    return *this;
+  }
+  SnapshotIterator operator++(int) {
+    SnapshotIterator tmp = *this;
+    ++(*this);
+    return tmp;
+  }
+  bool operator==(const SnapshotIterator &other) const {
+    return segment_ == other.segment_ && index_ == other.index_;
+  }
+  bool operator!=(const SnapshotIterator &other) const {
+    return !(*this == other);
+  }
+
+ private:
+  const SnapshotSegment<T> *segment_ = nullptr;
+  size_t index_ = 0;
+  const SnapshotSegment<T> *last_ = nullptr;
+};
+}  // namespace detail
+
+// FIFO sequence whose Snapshot() is O(1): the view shares the element
+// segments with the list instead of copying them. Elements are never
+// modified in place, so nothing has to be copied later either: pushes land
+// in slots no existing view can see, and pops only move the list's begin.
+// A popped element is destroyed once neither the list nor any view still
+// references its segment.
+template <typename T, typename StatsPolicy = NoStats>
+class SnapshotList {
+ private:
+  using Segment = detail::SnapshotSegment<T>;
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+  using const_iterator = detail::SnapshotIterator<T>;
+  using view_type = SnapshotListView<T>;
+
+  SnapshotList() = default;
+  SnapshotList(std::initializer_list<value_type> const &items) {
+    for (const auto &item : items) Push_back(item);
+  }
+  // Copies are deep, like List: two lists appending into one segment would
+  // overwrite each other's slots. Use Snapshot() for a cheap read-only copy.
+  SnapshotList(const SnapshotList &l) {
+    for (const auto &item : l) Push_back(item);
+  }
+  SnapshotList(SnapshotList &&l) noexcept { Swap(l); }
+  ~SnapshotList() { Clear(); }
+  SnapshotList &operator=(const SnapshotList &l) {
+    if (this != &l) {
+      SnapshotList copy(l);
+      Swap(copy);
+    }
+    return *this;
+  }
+  SnapshotList &operator=(SnapshotList &&l) noexcept {
+    if (this != &l) {
+      Clear();
+      Swap(l);
+    }
+    return *this;
+  }
+
+  const_reference Front() const {
+    if (Empty()) throw std::out_of_range("List is empty");
+    return head_->At(begin_);
+  }
+  const_reference Back() const {
+    if (Empty()) throw std::out_of_range("List is empty");
+    return tail_->At(tail_->used - 1);
+  }
+
+  const_iterator Begin() const { return Cbegin(); }
+  const_iterator End() const { return Cend(); }
+  const_iterator Cbegin() const {
+    return Empty() ? Cend() : const_iterator(head_.get(), begin_, tail_);
+  }
+  const_iterator Cend() const {
+    return tail_ ? const_iterator(tail_, tail_->used, tail_)
+                 : const_iterator();
+  }
+  const_iterator begin() const { return Cbegin(); }
+  const_iterator end() const { return Cend(); }
+
+  bool Empty() const { return size_ == 0; }
+  size_type Size() const { return size_; }
+
+  void Clear() {
+    if constexpr (StatsPolicy::kEnabled) {
+      for (Segment *segment = head_.get(); segment; segment = Next(segment)) {
+        stats_.On_free();
+      }
+    }
+    detail::Release_chain(head_);
+    tail_ = nullptr;
+    begin_ = size_ = 0;
+  }
+
+  void Push_back(const_reference value) { Emplace_back(value); }
+  void Push_back(value_type &&value) { Emplace_back(std::move(value)); }
+
+  template <typename... Args>
+  void Emplace_back(Args &&...args) {
+    if (!tail_ || tail_->used == Segment::kCapacity) Append_segment();
+    ::new (static_cast<void *>(&tail_->At(tail_->used)))
+        T(std::forward<Args>(args)...);
+    ++tail_->used;
+    ++size_;
+    stats_.On_push(size_);
+  }
+
+  template <typename... Args>
+  void Insert_many_back(Args &&...args) {
+    (Push_back(std::forward<Args>(args)), ...);
+  }
+
+  void Pop_front() {
+    if (Empty()) throw std::out_of_range("List is empty");
+    --size_;
+    stats_.On_pop();
+    if (++begin_ == Segment::kCapacity && head_.get() != tail_) {
+      std::shared_ptr<Segment> next = head_->next;
+      head_ = std::move(next);
+      begin_ = 0;
+      stats_.On_free();
+    }
+  }
+
+  void Swap(SnapshotList &other) noexcept {
+    std::swap(head_, other.head_);
+    std::swap(tail_, other.tail_);
+    std::swap(begin_, other.begin_);
+    std::swap(size_, other.size_);
+    std::swap(stats_, other.stats_);
+  }
+
+  // Immutable view of the current contents, O(1) in the list length. The
+  // view may be read from another thread while this list keeps pushing and
+  // popping; taking the snapshot itself must not race with a mutation.
+  view_type Snapshot() const {
+    return view_type(head_, tail_, begin_, Empty() ? begin_ : tail_->used,
+                     size_);
+  }
+
+  ContainerStats Stats() const { return stats_.Snapshot(); }
+
+ private:
+  static Segment *Next(Segment *segment) { return segment->next.get(); }
+
+  void Append_segment() {
+    std::shared_ptr<Segment> segment = std::make_shared<Segment>();
+    stats_.On_allocate();
+    if (tail_ && begin_ < Segment::kCapacity) {
+      tail_->next = segment;
+    } else {
+      // Empty, or every slot of the only segment has been popped.
+      Clear();
+      head_ = segment;
+    }
+    tail_ = segment.get();
+  }
+
+  std::shared_ptr<Segment> head_;
+  Segment *tail_ = nullptr;
+  size_type begin_ = 0;
+  size_type size_ = 0;
+  [[no_unique_address]] StatsPolicy stats_;
+};
+
+// Read-only, cheaply copyable view returned by SnapshotList::Snapshot().
+template <typename T>
+class SnapshotListView {
+ private:
+  using Segment = detail::SnapshotSegment<T>;
+
+ public:
+  using value_type = T;
+  using const_reference = const T &;
+  using size_type = size_t;
+  using const_iterator = detail::SnapshotIterator<T>;
+
+  SnapshotListView() = default;
+  SnapshotListView(const SnapshotListView &) = default;
+  SnapshotListView(SnapshotListView &&) noexcept = default;
+  SnapshotListView &operator=(SnapshotListView other) noexcept {
+    std::swap(head_, other.head_);
+    std::swap(last_, other.last_);
+    std::swap(begin_, other.begin_);
+    std::swap(end_, other.end_);
+    std::swap(size_, other.size_);
+    return *this;
+  }
+  ~SnapshotListView() { detail::Release_chain(head_); }
+
+  const_reference Front() const {
+    if (Empty()) throw std::out_of_range("List is empty");
+    return head_->At(begin_);
+  }
+  const_reference Back() const {
+    if (Empty()) throw std::out_of_range("List is empty");
+    return last_->At(end_ - 1);
+  }
+
+  const_iterator Begin() const { return Cbegin(); }
+  const_iterator End() const { return Cend(); }
+  const_iterator Cbegin() const {
+    return Empty() ? Cend() : const_iterator(head_.get(), begin_, last_);
+  }
+  const_iterator Cend() const {
+    return last_ ? const_iterator(last_, end_, last_) : const_iterator();
+  }
+  const_iterator begin() const { return Cbegin(); }
+  const_iterator end() const { return Cend(); }
+
+  bool Empty() const { return size_ == 0; }
+  size_type Size() const { return size_; }
+
+ private:
+  template <typename, typename>
+  friend class SnapshotList;
+
+  SnapshotListView(std::shared_ptr<Segment> head, const Segment *last,
+                   size_type begin, size_type end, size_type size)
+      : head_(std::move(head)),
+        last_(last),
+        begin_(begin),
+        end_(end),
+        size_(size) {}
+
+  std::shared_ptr<Segment> head_;
+  const Segment *last_ = nullptr;
+  size_type begin_ = 0;
+  size_type end_ = 0;
+  size_type size_ = 0;
+};
+}  // namespace s21
+
+#endif
@@ -0,0 +1,294 @@
+#ifndef S21_XOR_LIST_H
+#define S21_XOR_LIST_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_node_arena.h"
+
+namespace s21 {
+template <typename T>
+class XorList;
+
+namespace detail {
+// One link word per node: the address of the previous node XOR the address
+// of the next one, with null ends contributing zero.
+template <typename T>
+struct XorNode {
+  T value;
+  ArenaTag arena_tag;
+  uintptr_t link;
+};
+
+template <typename T>
+inline XorNode<T> *Xor(const XorNode<T> *a, const XorNode<T> *b) {
+  return reinterpret_cast<XorNode<T> *>(reinterpret_cast<uintptr_t>(a) ^
+                                        reinterpret_cast<uintptr_t>(b));
+}
+
+template <typename T>
+inline XorNode<T> *Other_side(const XorNode<T> *node,
+                              const XorNode<T> *neighbour) {
+  return reinterpret_cast<XorNode<T> *>(
+      node->link ^ reinterpret_cast<uintptr_t>(neighbour));
+}
+
+// A node alone cannot tell which way is forward, so the iterator carries
+// the node it came from as well. `Value` is T or const T.
+template <typename T, typename Value>
+class XorIterator {
+  using Node = XorNode<T>;
+
+ public:
+  using value_type = T;
+  using reference = Value &;
+  using pointer = Value *;
+  using difference_type = std::ptrdiff_t;
+  using iterator_category = std::bidirectional_iterator_tag;
+
+  XorIterator(Node *prev = nullptr, Node *ptr = nullptr)
+      : prev_(prev), ptr_(ptr) {}
+  template <typename Other>
+    requires(std::is_const_v<Value> && !std::is_same_v<Other, Value>)
+  XorIterator(const XorIterator<T, Other> &other)
+      : prev_(other.prev_), ptr_(other.ptr_) {}
+
+  reference operator*() const {
+    if (!ptr_) throw std::out_of_range("Iterator dereference null pointer");
+    return ptr_->value;
+  }
+  pointer operator->() const { return &**this; }
+  XorIterator &operator++() {
+    if (ptr_) prev_ = std::exchange(ptr_, Other_side(ptr_, prev_));
+    return *this;
+  }
+  XorIterator operator++(int) {
+    XorIterator tmp = *this;
+    ++*this;
+    return tmp;
+  }
+  // From End() this lands on the last element.
+  XorIterator &operator--() {
+    if (prev_) ptr_ = std::exchange(prev_, Other_side(prev_, ptr_));
+    return *this;
+  }
+  XorIterator operator--(int) {
+    XorIterator tmp = *this;
+    --*this;
+    return tmp;
+  }
+  bool operator==(const XorIterator &other) const {
+    return ptr_ == other.ptr_;
+  }
+
+ private:
+  template <typename, typename>
+  friend class XorIterator;
+  template <typename>
+  friend class s21::XorList;
+
+  Node *prev_;
+  Node *ptr_;
+};
+}  // namespace detail
+
+// Doubly linked list that stores a single XOR'd link word per node instead
+// of separate next and prev pointers, with every node carved from a
+// NodeArena so there is no per-node allocator header either. A
+// List<uint32_t> node takes 24 bytes plus malloc overhead; here it takes 16.
+//
+// Iteration runs both ways, Splice of a whole list is O(1), and so is
+// Reverse(), which only swaps the two ends. The price is that an iterator
+// is two pointers and identifies its node only together with its neighbour:
+// Insert and Erase invalidate iterators to the neighbours of the changed
+// position, and Reverse invalidates all of them. Slots of erased elements
+// are reused by later insertions and go back to the system on Clear().
+template <typename T>
+class XorList {
+  using Node = detail::XorNode<T>;
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+  using iterator = detail::XorIterator<T, T>;
+  using const_iterator = detail::XorIterator<T, const T>;
+
+  XorList() = default;
+  XorList(std::initializer_list<value_type> const &items) {
+    Reserve(items.size());
+    for (const auto &item : items) Push_back(item);
+  }
+  XorList(const XorList &other) {
+    Reserve(other.size_);
+    for (const auto &item : other) Push_back(item);
+  }
+  XorList(XorList &&other) noexcept { Swap(other); }
+  ~XorList() { Clear(); }
+  XorList &operator=(const XorList &other) {
+    if (this != &other) {
+      XorList copy(other);
+      Swap(copy);
+    }
+    return *this;
+  }
+  XorList &operator=(XorList &&other) noexcept {
+    if (this != &other) {
+      Clear();
+      Swap(other);
+    }
+    return *this;
+  }
+
+  const_reference Front() const {
+    if (Empty()) throw std::out_of_range("List is empty");
+    return head_->value;
+  }
+  const_reference Back() const {
+    if (Empty()) throw std::out_of_range("List is empty");
+    return tail_->value;
+  }
+
+  iterator Begin() { return iterator(nullptr, head_); }
+  iterator End() { return iterator(tail_, nullptr); }
+  const_iterator Cbegin() const { return const_iterator(nullptr, head_); }
+  const_iterator Cend() const { return const_iterator(tail_, nullptr); }
+  iterator begin() { return Begin(); }
+  iterator end() { return End(); }
+  const_iterator begin() const { return Cbegin(); }
+  const_iterator end() const { return Cend(); }
+
+  bool Empty() const { return size_ == 0; }
+  size_type Size() const { return size_; }
+  size_type size() const { return size_; }
+
+  // Destroys every element and hands the arena blocks back.
+  void Clear() {
+    {
+      typename detail::NodeArena<Node>::Releaser release;
+      for (Node *prev = nullptr, *node = head_; node;) {
+        Node *next = detail::Other_side(node, prev);
+        const detail::ArenaTag tag = node->arena_tag;
+        node->~Node();
+        release.Add(node, tag);
+        prev = std::exchange(node, next);
+      }
+    }
+    delete arena_;
+    arena_ = nullptr;
+    head_ = tail_ = nullptr;
+    size_ = 0;
+  }
+
+  // Inserts before `pos` and returns an iterator to the new element.
+  iterator Insert(iterator pos, const_reference value) {
+    Node *node = Create_node(value, detail::Xor(pos.prev_, pos.ptr_));
+    Relink(pos.prev_, pos.ptr_, node, &head_);
+    Relink(pos.ptr_, pos.prev_, node, &tail_);
+    ++size_;
+    return iterator(pos.prev_, node);
+  }
+  // Returns an iterator to the element after the erased one.
+  iterator Erase(iterator pos) {
+    if (!pos.ptr_) throw std::out_of_range("Cannot erase at end iterator");
+    Node *next = detail::Other_side(pos.ptr_, pos.prev_);
+    Relink(pos.prev_, pos.ptr_, next, &head_);
+    Relink(next, pos.ptr_, pos.prev_, &tail_);
+    Destroy_node(pos.ptr_);
+    --size_;
+    return iterator(pos.prev_, next);
+  }
+
+  void Push_back(const_reference value) { Insert(End(), value); }
+  void Push_front(const_reference value) { Insert(Begin(), value); }
+  void Pop_back() {
+    if (Empty()) throw std::out_of_range("List is empty");
+    Erase(iterator(reinterpret_cast<Node *>(tail_->link), tail_));
+  }
+  void Pop_front() {
+    if (Empty()) throw std::out_of_range("List is empty");
+    Erase(Begin());
+  }
+
+  // Moves every node of `other` in front of `pos` in O(1).
+  void Splice(iterator pos, XorList &other) {
+    if (&other != this && !other.Empty()) {
+      Relink(pos.prev_, pos.ptr_, other.head_, &head_);
+      Relink(pos.ptr_, pos.prev_, other.tail_, &tail_);
+      other.head_->link ^= reinterpret_cast<uintptr_t>(pos.prev_);
+      other.tail_->link ^= reinterpret_cast<uintptr_t>(pos.ptr_);
+      size_ += other.size_;
+      other.head_ = other.tail_ = nullptr;
+      other.size_ = 0;
+    }
+  }
+
+  void Reverse() { std::swap(head_, tail_); }
+
+  void Swap(XorList &other) noexcept {
+    std::swap(head_, other.head_);
+    std::swap(tail_, other.tail_);
+    std::swap(size_, other.size_);
+    std::swap(arena_, other.arena_);
+  }
+
+  // Makes room for n more elements in one contiguous block.
+  void Reserve(size_type n) {
+    if (!arena_) arena_ = new detail::NodeArena<Node>;
+    if (arena_->Available() < n) arena_->Reserve(n);
+  }
+
+ private:
+  // In `node`, which used to sit next to `old_neighbour`, replaces that
+  // link with `new_neighbour`; a null `node` means the list end `*end`.
+  static void Relink(Node *node, Node *old_neighbour, Node *new_neighbour,
+                     Node **end) {
+    if (node) {
+      node->link ^= reinterpret_cast<uintptr_t>(
+          detail::Xor(old_neighbour, new_neighbour));
+    } else {
+      *end = new_neighbour;
+    }
+  }
+
+  // Grows the arena by half the current size, so blocks stay few and the
+  // unused tail of the newest one stays under a third of the total.
+  Node *Create_node(const_reference value, Node *link) {
+    if (!arena_ || arena_->Available() == 0) {
+      Reserve(std::max<size_type>(64, size_ / 2));
+    }
+    detail::ArenaTag tag = 0;
+    Node *node = arena_->Create(&tag, value, detail::ArenaTag{0},
+                                reinterpret_cast<uintptr_t>(link));
+    node->arena_tag = tag;
+    return node;
+  }
+
+  // Spliced-in nodes may come from another list's blocks, and a list that
+  // never allocated has no arena.
+  void Destroy_node(Node *node) {
+    const detail::ArenaTag tag = node->arena_tag;
+    node->~Node();
+    if (arena_) {
+      arena_->Recycle(node, tag);
+    } else {
+      detail::NodeArena<Node>::Release(node, tag);
+    }
+  }
+
+  Node *head_ = nullptr;
+  Node *tail_ = nullptr;
+  size_type size_ = 0;
+  detail::NodeArena<Node> *arena_ = nullptr;
+};
+}  // namespace s21
+
+#endif
@@ -0,0 +1,268 @@
+#ifndef S21_ASYNC_QUEUE_H
+#define S21_ASYNC_QUEUE_H
+
+#include <condition_variable>
+#include <coroutine>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "s21_queue.h"
+
+namespace s21 {
+// Fire-and-forget coroutine. It does not start until handed to an
+// Executor, and its frame frees itself when the body returns.
+class Task {
+ public:
+  struct promise_type {
+    Task get_return_object() {
+      return Task(std::coroutine_handle<promise_type>::from_promise(*this));
+    }
+    std::suspend_always initial_suspend() noexcept { return {}; }
+    std::suspend_never final_suspend() noexcept { return {}; }
+    void return_void() noexcept {}
+    void unhandled_exception() noexcept { std::terminate(); }
+  };
+
+  Task(Task &&other) noexcept : handle_(std::exchange(other.handle_, {})) {}
+  Task(const Task &) = delete;
+  Task &operator=(const Task &) = delete;
+  Task &operator=(Task &&) = delete;
+  ~Task() {
+    if (handle_) handle_.destroy();
+  }
+
+  // Hands the not yet started coroutine over to the caller.
+  std::coroutine_handle<> Release() { return std::exchange(handle_, {}); }
+
+ private:
+  explicit Task(std::coroutine_handle<promise_type> handle)
+      : handle_(handle) {}
+
+  std::coroutine_handle<promise_type> handle_;
+};
+
+// Something that resumes coroutines. Schedule may be called from any
+// thread.
+class Executor {
+ public:
+  virtual ~Executor() = default;
+  virtual void Schedule(std::coroutine_handle<> handle) = 0;
+  void Spawn(Task task) { Schedule(task.Release()); }
+};
+
+// Runs every scheduled coroutine on the thread that calls Run().
+class SingleThreadExecutor : public Executor {
+ public:
+  SingleThreadExecutor() = default;
+  SingleThreadExecutor(const SingleThreadExecutor &) = delete;
+  SingleThreadExecutor &operator=(const SingleThreadExecutor &) = delete;
+  // Coroutines scheduled but never run are destroyed, not leaked.
+  ~SingleThreadExecutor() override {
+    while (!ready_.Empty()) {
+      ready_.Front().destroy();
+      ready_.Pop();
+    }
+  }
+
+  void Schedule(std::coroutine_handle<> handle) override {
+    std::lock_guard<std::mutex> guard(lock_);
+    ready_.Push(handle);
+  }
+
+  // Resumes coroutines until none is ready. Coroutines still waiting on a
+  // queue stay suspended and run on a later call once they are woken up.
+  // Returns the number of resumptions.
+  size_t Run() {
+    size_t resumed = 0;
+    for (std::coroutine_handle<> handle; Next(handle); ++resumed) {
+      handle.resume();
+    }
+    return resumed;
+  }
+
+ private:
+  bool Next(std::coroutine_handle<> &handle) {
+    std::lock_guard<std::mutex> guard(lock_);
+    bool ready = !ready_.Empty();
+    if (ready) {
+      handle = ready_.Front();
+      ready_.Pop();
+    }
+    return ready;
+  }
+
+  std::mutex lock_;
+  Queue<std::coroutine_handle<>> ready_;
+};
+
+// Fixed pool of worker threads sharing one ready queue. The destructor
+// finishes the coroutines that are ready and joins the workers.
+class ThreadPoolExecutor : public Executor {
+ public:
+  explicit ThreadPoolExecutor(
+      unsigned threads = std::thread::hardware_concurrency()) {
+    if (threads == 0) threads = 1;
+    for (unsigned i = 0; i < threads; ++i) {
+      workers_.emplace_back([this] { Work(); });
+    }
+  }
+  ThreadPoolExecutor(const ThreadPoolExecutor &) = delete;
+  ThreadPoolExecutor &operator=(const ThreadPoolExecutor &) = delete;
+  ~ThreadPoolExecutor() override {
+    {
+      std::lock_guard<std::mutex> guard(lock_);
+      stopping_ = true;
+    }
+    wakeup_.notify_all();
+    for (auto &worker : workers_) worker.join();
+  }
+
+  void Schedule(std::coroutine_handle<> handle) override {
+    {
+      std::lock_guard<std::mutex> guard(lock_);
+      ready_.Push(handle);
+    }
+    wakeup_.notify_one();
+  }
+
+ private:
+  void Work() {
+    std::unique_lock<std::mutex> guard(lock_);
+    while (true) {
+      wakeup_.wait(guard, [this] { return stopping_ || !ready_.Empty(); });
+      if (ready_.Empty()) break;
+      std::coroutine_handle<> handle = ready_.Front();
+      ready_.Pop();
+      guard.unlock();
+      handle.resume();
+      guard.lock();
+    }
+  }
+
+  std::mutex lock_;
+  std::condition_variable wakeup_;
+  Queue<std::coroutine_handle<>> ready_;
+  bool stopping_ = false;
+  std::vector<std::thread> workers_;
+};
+
+// FIFO queue for coroutines: `T value = co_await queue.Pop();` suspends the
+// consumer until an element is available instead of blocking its thread.
+// Each Push hands its element straight to the longest waiting consumer and
+// schedules exactly that one on the queue's executor. Push and Pop may be
+// called from any thread. The queue must be destroyed before its executor;
+// consumers still suspended on it at that point are destroyed with it.
+template <typename T>
+class AsyncQueue {
+ public:
+  using value_type = T;
+  using const_reference = const T &;
+  using size_type = size_t;
+
+  class PopAwaiter {
+   public:
+    bool await_ready() { return queue_.Try_take(value_); }
+    bool await_suspend(std::coroutine_handle<> handle) {
+      handle_ = handle;
+      return queue_.Wait(*this);
+    }
+    T await_resume() { return std::move(*value_); }
+
+   private:
+    friend class AsyncQueue;
+    explicit PopAwaiter(AsyncQueue &queue) : queue_(queue) {}
+
+    AsyncQueue &queue_;
+    std::coroutine_handle<> handle_;
+    std::optional<T> value_;
+  };
+
+  explicit AsyncQueue(Executor &executor) : executor_(executor) {}
+  AsyncQueue(const AsyncQueue &) = delete;
+  AsyncQueue &operator=(const AsyncQueue &) = delete;
+  // The awaiter lives in the frame it belongs to, so its handle is read
+  // before the frame goes away.
+  ~AsyncQueue() {
+    while (!waiters_.Empty()) {
+      std::coroutine_handle<> handle = waiters_.Front()->handle_;
+      waiters_.Pop_front();
+      handle.destroy();
+    }
+  }
+
+  void Push(const_reference value) { Emplace(value); }
+  void Push(T &&value) { Emplace(std::move(value)); }
+
+  PopAwaiter Pop() { return PopAwaiter(*this); }
+
+  std::optional<T> Try_pop() {
+    std::optional<T> value;
+    Try_take(value);
+    return value;
+  }
+
+  // Number of buffered elements; zero whenever consumers are waiting.
+  size_type Size() const {
+    std::lock_guard<std::mutex> guard(lock_);
+    return items_.Size();
+  }
+  bool Empty() const { return Size() == 0; }
+  // Number of suspended consumers.
+  size_type Waiting() const {
+    std::lock_guard<std::mutex> guard(lock_);
+    return waiters_.Size();
+  }
+
+ private:
+  template <typename U>
+  void Emplace(U &&value) {
+    PopAwaiter *waiter = nullptr;
+    {
+      std::lock_guard<std::mutex> guard(lock_);
+      if (waiters_.Empty()) {
+        items_.Push_back(std::forward<U>(value));
+      } else {
+        waiter = waiters_.Front();
+        waiters_.Pop_front();
+        waiter->value_.emplace(std::forward<U>(value));
+      }
+    }
+    if (waiter) executor_.Schedule(waiter->handle_);
+  }
+
+  bool Try_take(std::optional<T> &value) {
+    std::lock_guard<std::mutex> guard(lock_);
+    return Take_locked(value);
+  }
+
+  bool Take_locked(std::optional<T> &value) {
+    bool taken = !items_.Empty();
+    if (taken) {
+      value.emplace(std::move(*items_.Begin()));
+      items_.Pop_front();
+    }
+    return taken;
+  }
+
+  // Registers `waiter` unless an element arrived since await_ready. Once the
+  // lock is released another thread may resume the waiter at any moment, so
+  // nothing touches it afterwards.
+  bool Wait(PopAwaiter &waiter) {
+    std::lock_guard<std::mutex> guard(lock_);
+    bool suspend = !Take_locked(waiter.value_);
+    if (suspend) waiters_.Push_back(&waiter);
+    return suspend;
+  }
+
+  Executor &executor_;
+  mutable std::mutex lock_;
+  List<T> items_;
+  List<PopAwaiter *> waiters_;
+};
+}  // namespace s21
+
+#endif
@@ -0,0 +1,199 @@
+#ifndef S21_BROADCAST_RING_H
+#define S21_BROADCAST_RING_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+#include "../list/s21_list.h"
+
+namespace s21 {
+// Pre-allocated ring that delivers every published element to every
+// subscriber. Each subscriber owns a read cursor and reads slots in place,
+// so one copy of an event serves any number of readers. Producers claim
+// whole batches of slots and may not lap the slowest subscriber: the ring
+// holds `capacity` elements not yet read by everyone. Any number of
+// producers and subscribers may run concurrently; each Subscriber object is
+// used by one thread at a time.
+template <typename T>
+class BroadcastRing {
+  // Next sequence a subscriber will read, alone on its cache line so
+  // readers do not invalidate each other.
+  struct alignas(64) Cursor {
+    std::atomic<uint64_t> next{0};
+  };
+
+ public:
+  using value_type = T;
+  using const_reference = const T &;
+  using size_type = size_t;
+
+  // A registered reader. Leaves the ring when destroyed, after which it no
+  // longer holds producers back.
+  class Subscriber {
+   public:
+    Subscriber(Subscriber &&other) noexcept
+        : ring_(std::exchange(other.ring_, nullptr)),
+          cursor_(std::move(other.cursor_)) {}
+    Subscriber(const Subscriber &) = delete;
+    Subscriber &operator=(const Subscriber &) = delete;
+    Subscriber &operator=(Subscriber &&) = delete;
+    ~Subscriber() {
+      if (ring_) ring_->Unsubscribe(cursor_.get());
+    }
+
+    // Calls `fn(const T &)` on up to `max` published elements this
+    // subscriber has not seen yet, then releases their slots. Returns how
+    // many were read; 0 means the subscriber is caught up.
+    template <typename Fn>
+    size_type Poll(Fn fn, size_type max = SIZE_MAX) {
+      const uint64_t next = cursor_->next.load(std::memory_order_relaxed);
+      const uint64_t ready = ring_->published_.load(std::memory_order_acquire);
+      const uint64_t count = std::min<uint64_t>(ready - next, max);
+      for (uint64_t seq = next; seq < next + count; ++seq) {
+        fn(static_cast<const T &>(ring_->slots_[seq & ring_->mask_]));
+      }
+      if (count) cursor_->next.store(next + count, std::memory_order_release);
+      return static_cast<size_type>(count);
+    }
+
+    // Published elements not read yet.
+    size_type Lag() const {
+      return static_cast<size_type>(
+          ring_->published_.load(std::memory_order_acquire) -
+          cursor_->next.load(std::memory_order_relaxed));
+    }
+
+   private:
+    friend class BroadcastRing;
+    Subscriber(BroadcastRing *ring, std::unique_ptr<Cursor> cursor)
+        : ring_(ring), cursor_(std::move(cursor)) {}
+
+    BroadcastRing *ring_;
+    std::unique_ptr<Cursor> cursor_;
+  };
+
+  // Rounds `capacity` up to a power of two.
+  explicit BroadcastRing(size_type capacity = 1024)
+      : mask_(Round_up(capacity) - 1), slots_(new T[mask_ + 1]) {}
+  BroadcastRing(const BroadcastRing &) = delete;
+  BroadcastRing &operator=(const BroadcastRing &) = delete;
+
+  // Starts reading at the next element to be published. Every Subscriber
+  // must be destroyed before the ring.
+  Subscriber Subscribe() {
+    auto cursor = std::make_unique<Cursor>();
+    std::lock_guard<std::mutex> guard(cursors_lock_);
+    cursor->next.store(published_.load(std::memory_order_acquire),
+                       std::memory_order_relaxed);
+    cursors_.Push_back(cursor.get());
+    return Subscriber(this, std::move(cursor));
+  }
+
+  // Claims `n` consecutive slots, waiting while the slowest subscriber is
+  // less than `n` slots behind, calls `fill(T &slot, i)` for i in [0, n)
+  // and publishes all of them at once. A batch larger than Capacity() could
+  // never fit and throws std::length_error before anything is claimed.
+  template <typename Fill>
+  void Publish(size_type n, Fill fill) {
+    if (n > Capacity()) {
+      throw std::length_error("Batch is larger than the ring");
+    }
+    if (n == 0) return;
+    const uint64_t first = claimed_.fetch_add(n, std::memory_order_relaxed);
+    Wait_for_room(first + n);
+    for (size_type i = 0; i < n; ++i) fill(slots_[(first + i) & mask_], i);
+    Commit(first, first + n);
+  }
+  void Publish(const_reference value) {
+    Publish(1, [&value](T &slot, size_type) { slot = value; });
+  }
+
+  // Publishes `value` unless that would overwrite a slot some subscriber
+  // has not read. Never waits for subscribers.
+  bool Try_publish(const_reference value) {
+    uint64_t first = claimed_.load(std::memory_order_relaxed);
+    do {
+      if (!Has_room(first + 1)) return false;
+    } while (!claimed_.compare_exchange_weak(first, first + 1,
+                                             std::memory_order_relaxed));
+    slots_[first & mask_] = value;
+    Commit(first, first + 1);
+    return true;
+  }
+
+  size_type Capacity() const { return mask_ + 1; }
+  // Elements published since construction.
+  uint64_t Published() const {
+    return published_.load(std::memory_order_acquire);
+  }
+  size_type Subscriber_count() const {
+    std::lock_guard<std::mutex> guard(cursors_lock_);
+    return cursors_.Size();
+  }
+
+ private:
+  static size_type Round_up(size_type n) {
+    size_type power = 1;
+    while (power < n) power <<= 1;
+    return power;
+  }
+
+  // True when sequences below `end` may be written. The cached gate is
+  // checked first so producers scan the cursors only when it is too low.
+  bool Has_room(uint64_t end) {
+    if (end <= gate_.load(std::memory_order_acquire) + Capacity()) return true;
+    std::lock_guard<std::mutex> guard(cursors_lock_);
+    // Never past published_, so a slot is not reused before the producer
+    // that claimed it a lap earlier has committed it.
+    uint64_t slowest = published_.load(std::memory_order_acquire);
+    for (auto it = cursors_.Begin(); it != cursors_.End(); ++it) {
+      slowest = std::min(slowest, (*it)->next.load(std::memory_order_acquire));
+    }
+    uint64_t gate = gate_.load(std::memory_order_relaxed);
+    while (gate < slowest && !gate_.compare_exchange_weak(
+                                 gate, slowest, std::memory_order_release)) {
+    }
+    return end <= slowest + Capacity();
+  }
+
+  void Wait_for_room(uint64_t end) {
+    while (!Has_room(end)) std::this_thread::yield();
+  }
+
+  // Producers publish in claim order, so a reader that sees `published_`
+  // sees every slot below it written.
+  void Commit(uint64_t first, uint64_t end) {
+    while (published_.load(std::memory_order_acquire) != first) {
+      std::this_thread::yield();
+    }
+    published_.store(end, std::memory_order_release);
+  }
+
+  void Unsubscribe(Cursor *cursor) {
+    std::lock_guard<std::mutex> guard(cursors_lock_);
+    for (auto it = cursors_.Begin(); it != cursors_.End(); ++it) {
+      if (*it == cursor) {
+        cursors_.Erase(it);
+        break;
+      }
+    }
+  }
+
+  const uint64_t mask_;
+  std::unique_ptr<T[]> slots_;
+  alignas(64) std::atomic<uint64_t> claimed_{0};
+  alignas(64) std::atomic<uint64_t> published_{0};
+  alignas(64) std::atomic<uint64_t> gate_{0};
+  mutable std::mutex cursors_lock_;
+  List<Cursor *> cursors_;
+};
+}  // namespace s21
+
+#endif
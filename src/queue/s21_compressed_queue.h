@@ -0,0 +1,13 @@
+#ifndef S21_COMPRESSED_QUEUE_H
+#define S21_COMPRESSED_QUEUE_H
+
+#include "../list/s21_compressed_list.h"
+#include "s21_queue.h"
+
+namespace s21 {
+// Queue of integers kept in delta-encoded, bit-packed blocks.
+template <typename T, typename StatsPolicy = NoStats>
+using CompressedQueue = Queue<T, StatsPolicy, CompressedList<T, StatsPolicy>>;
+}  // namespace s21
+
+#endif
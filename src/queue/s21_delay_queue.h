@@ -0,0 +1,193 @@
+#ifndef S21_DELAY_QUEUE_H
+#define S21_DELAY_QUEUE_H
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <limits>
+
+#include "../list/s21_list.h"
+
+namespace s21 {
+// Timers keyed by an integer deadline, stored in a hierarchical timing
+// wheel: kLevels wheels of kSlots buckets, each bucket an s21::List. A
+// timer sits on the level of the highest kSlotBits-bit digit in which its
+// deadline differs from the current time, in the slot given by that digit.
+// Scheduling and cancelling touch one bucket. Advancing the clock moves a
+// bucket down one level whenever the time reaches it, node by node with
+// Splice, and hands due buckets to the caller with a single Splice each.
+// Every timer therefore moves at most kLevels times, however far away it
+// was scheduled.
+template <typename T>
+class DelayQueue {
+ public:
+  using value_type = T;
+  using tick_type = uint64_t;
+  using size_type = size_t;
+
+  static constexpr unsigned kSlotBits = 6;
+  static constexpr unsigned kSlots = 1u << kSlotBits;
+  static constexpr unsigned kLevels =
+      (std::numeric_limits<tick_type>::digits + kSlotBits - 1) / kSlotBits;
+
+  class Entry {
+   public:
+    Entry(tick_type at, const T &val) : deadline(at), value(val) {}
+
+    // Change it only through Reschedule.
+    tick_type deadline;
+    T value;
+
+   private:
+    friend class DelayQueue;
+    uint8_t level_ = 0;
+    uint8_t slot_ = 0;
+  };
+
+  // Stays valid until the timer is handed out by Pop_expired or cancelled.
+  using Handle = typename List<Entry>::iterator;
+
+  explicit DelayQueue(tick_type now = 0) : now_(now), size_(0) {}
+  DelayQueue(const DelayQueue &) = delete;
+  DelayQueue &operator=(const DelayQueue &) = delete;
+
+  // Deadlines that already passed fire on the next Pop_expired call.
+  Handle Schedule(tick_type deadline, const T &value) {
+    unsigned level = 0;
+    unsigned slot = 0;
+    Locate(deadline, level, slot);
+    List<Entry> &bucket = wheel_[level][slot];
+    Handle handle = bucket.Insert(bucket.End(), Entry(deadline, value));
+    Settle(handle, level, slot);
+    ++size_;
+    return handle;
+  }
+
+  void Cancel(Handle handle) {
+    List<Entry> &bucket = Bucket_of(handle);
+    const unsigned level = handle->level_;
+    const unsigned slot = handle->slot_;
+    bucket.Erase(handle);
+    if (bucket.Empty()) Unmark(level, slot);
+    --size_;
+  }
+
+  void Reschedule(Handle handle, tick_type deadline) {
+    handle->deadline = deadline;
+    Place(Bucket_of(handle), handle);
+  }
+
+  // Advances the clock to `now` and appends every timer whose deadline is
+  // not later than `now` to `out`, earliest deadline bucket first. Returns
+  // the number of timers appended. The clock never moves backwards.
+  size_type Pop_expired(tick_type now, List<Entry> &out) {
+    size_type expired = Expire_current(out);
+    for (tick_type next = Next_event(); size_ > 0 && next <= now;
+         next = Next_event()) {
+      now_ = next;
+      Cascade();
+      expired += Expire_current(out);
+    }
+    now_ = std::max(now_, now);
+    return expired;
+  }
+
+  tick_type Now() const { return now_; }
+  bool Empty() const { return size_ == 0; }
+  size_type Size() const { return size_; }
+
+ private:
+  static unsigned Shift(unsigned level) { return kSlotBits * level; }
+  static unsigned Digit(tick_type time, unsigned level) {
+    return static_cast<unsigned>(time >> Shift(level)) & (kSlots - 1);
+  }
+
+  void Locate(tick_type deadline, unsigned &level, unsigned &slot) const {
+    const tick_type due = std::max(deadline, now_);
+    const tick_type differs = due ^ now_;
+    level = differs ? (std::bit_width(differs) - 1) / kSlotBits : 0;
+    slot = Digit(due, level);
+  }
+
+  List<Entry> &Bucket_of(Handle handle) {
+    return wheel_[handle->level_][handle->slot_];
+  }
+
+  void Settle(Handle handle, unsigned level, unsigned slot) {
+    handle->level_ = static_cast<uint8_t>(level);
+    handle->slot_ = static_cast<uint8_t>(slot);
+    occupied_[level] |= uint64_t{1} << slot;
+  }
+  void Unmark(unsigned level, unsigned slot) {
+    occupied_[level] &= ~(uint64_t{1} << slot);
+  }
+
+  // Moves one timer from `from` to the bucket its deadline calls for now.
+  void Place(List<Entry> &from, Handle handle) {
+    const unsigned old_level = handle->level_;
+    const unsigned old_slot = handle->slot_;
+    unsigned level = 0;
+    unsigned slot = 0;
+    Locate(handle->deadline, level, slot);
+    List<Entry> &to = wheel_[level][slot];
+    to.Splice(to.End(), from, handle);
+    Settle(handle, level, slot);
+    if (from.Empty()) Unmark(old_level, old_slot);
+  }
+
+  // Earliest time after now_ at which some bucket falls due. Lower levels
+  // only hold timers inside the current slot of the level above, so the
+  // first level with an occupied slot ahead of the clock decides.
+  tick_type Next_event() const {
+    tick_type next = std::numeric_limits<tick_type>::max();
+    bool found = false;
+    for (unsigned level = 0; level < kLevels && !found; ++level) {
+      const unsigned current = Digit(now_, level);
+      const uint64_t ahead =
+          current + 1 < kSlots
+              ? occupied_[level] & (~uint64_t{0} << (current + 1))
+              : 0;
+      if (ahead) {
+        const unsigned upper = Shift(level + 1);
+        const tick_type base =
+            upper < std::numeric_limits<tick_type>::digits
+                ? now_ >> upper << upper
+                : 0;
+        next = base + (static_cast<tick_type>(std::countr_zero(ahead))
+                       << Shift(level));
+        found = true;
+      }
+    }
+    return next;
+  }
+
+  // Redistributes the buckets the clock has just reached, top level first
+  // so that timers falling through several levels are handled in one go.
+  void Cascade() {
+    for (unsigned level = kLevels - 1; level > 0; --level) {
+      List<Entry> &bucket = wheel_[level][Digit(now_, level)];
+      while (!bucket.Empty()) Place(bucket, bucket.Begin());
+    }
+  }
+
+  size_type Expire_current(List<Entry> &out) {
+    const unsigned slot = Digit(now_, 0);
+    List<Entry> &bucket = wheel_[0][slot];
+    const size_type count = bucket.Size();
+    if (count > 0) {
+      out.Splice(out.End(), bucket);
+      Unmark(0, slot);
+      size_ -= count;
+    }
+    return count;
+  }
+
+  std::array<std::array<List<Entry>, kSlots>, kLevels> wheel_;
+  std::array<uint64_t, kLevels> occupied_{};
+  tick_type now_;
+  size_type size_;
+};
+}  // namespace s21
+
+#endif
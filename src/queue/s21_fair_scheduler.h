@@ -0,0 +1,119 @@
+#ifndef S21_FAIR_SCHEDULER_H
+#define S21_FAIR_SCHEDULER_H
+
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+#include "../list/s21_list.h"
+
+namespace s21 {
+// Per-key FIFO queues served by deficit round robin. Only keys with queued
+// elements sit in the active ring, so Dequeue() is O(1) no matter how many
+// idle keys exist. Every element costs one unit, and a key of weight w may
+// dequeue w elements per turn before the ring moves on.
+template <typename Key, typename T, typename Hash = std::hash<Key>>
+class FairScheduler {
+ public:
+  using key_type = Key;
+  using value_type = T;
+  using const_reference = const T &;
+  using size_type = size_t;
+
+  // Weight of keys never passed to Set_weight.
+  explicit FairScheduler(size_type default_weight = 1)
+      : default_weight_(Check_weight(default_weight)) {}
+  FairScheduler(const FairScheduler &) = delete;
+  FairScheduler &operator=(const FairScheduler &) = delete;
+
+  // The key joins the ring before its element is queued, and leaves it
+  // again if the copy throws, so no element is ever left outside the ring.
+  void Enqueue(const Key &key, const_reference value) {
+    Flow &flow = Find_or_add(key);
+    const bool activate = !flow.active;
+    if (activate) active_.Push_back(&flow);
+    try {
+      flow.items.Push_back(value);
+    } catch (...) {
+      if (activate) active_.Pop_back();
+      throw;
+    }
+    flow.active = true;
+    ++size_;
+  }
+
+  // Removes the next element in fair order, or returns nothing when every
+  // queue is empty.
+  std::optional<T> Dequeue() {
+    std::optional<T> value;
+    if (!active_.Empty()) {
+      Flow &flow = *active_.Front();
+      if (flow.deficit == 0) flow.deficit = flow.weight;
+      value.emplace(std::move(*flow.items.Begin()));
+      flow.items.Pop_front();
+      --flow.deficit;
+      --size_;
+      if (flow.items.Empty()) {
+        flow.deficit = 0;
+        flow.active = false;
+        active_.Pop_front();
+      } else if (flow.deficit == 0) {
+        active_.Splice(active_.End(), active_, active_.Begin());
+      }
+    }
+    return value;
+  }
+
+  // Takes effect from the key's next turn. Throws std::invalid_argument
+  // for a weight of zero.
+  void Set_weight(const Key &key, size_type weight) {
+    Find_or_add(key).weight = Check_weight(weight);
+  }
+  size_type Weight(const Key &key) const {
+    auto it = flows_.find(key);
+    return it == flows_.end() ? default_weight_ : it->second.weight;
+  }
+
+  // Elements queued under `key`.
+  size_type Size(const Key &key) const {
+    auto it = flows_.find(key);
+    return it == flows_.end() ? 0 : it->second.items.Size();
+  }
+  size_type Size() const { return size_; }
+  bool Empty() const { return size_ == 0; }
+  // Keys with at least one queued element.
+  size_type Active_count() const { return active_.Size(); }
+
+ private:
+  struct Flow {
+    List<T> items;
+    size_type weight;
+    size_type deficit = 0;
+    bool active = false;
+  };
+
+  static size_type Check_weight(size_type weight) {
+    if (weight == 0) throw std::invalid_argument("Weight must be positive");
+    return weight;
+  }
+
+  // unordered_map nodes never move, so the ring can hold plain pointers.
+  Flow &Find_or_add(const Key &key) {
+    auto it = flows_.find(key);
+    if (it == flows_.end()) {
+      it = flows_.emplace(key, Flow{List<T>(), default_weight_}).first;
+    }
+    return it->second;
+  }
+
+  const size_type default_weight_;
+  std::unordered_map<Key, Flow, Hash> flows_;
+  List<Flow *> active_;
+  size_type size_ = 0;
+};
+}  // namespace s21
+
+#endif
@@ -3,14 +3,21 @@
 
 #include <initializer_list>
 #include <iostream>
+#include <iterator>
+#include <ranges>
 
 #include "../list/s21_list.h"
+#include "s21_queue_stats.h"
 
 namespace s21 {
-template <typename T>
+// Container provides Push_back, Pop_front, Front, Back, Empty, Size, Swap,
+// Insert_many_back and Stats, like List and SnapshotList.
+template <typename T, typename StatsPolicy = NoStats,
+          typename Container = List<T, StatsPolicy>>
 class Queue {
  private:
-  List<T> container_;
+  Container container_;
+  [[no_unique_address]] LatencyTracker<StatsPolicy::kEnabled> latency_;
 
  public:
   using value_type = T;
@@ -19,10 +26,13 @@ class Queue {
   using size_type = size_t;
 
   Queue() = default;
-  Queue(std::initializer_list<value_type> const &items) : container_(items) {}
+  Queue(std::initializer_list<value_type> const &items) : container_(items) {
+    for (size_type i = 0; i < items.size(); ++i) latency_.On_enqueue();
+  }
   Queue(const Queue &q) = default;
   Queue(Queue &&q) = default;
   ~Queue() = default;
+  Queue &operator=(const Queue &q) = default;
   Queue &operator=(Queue &&q) = default;
 
   const_reference Front() const { return container_.Front(); }
@@ -31,13 +41,76 @@ class Queue {
   bool Empty() const { return container_.Empty(); }
   size_type Size() const { return container_.Size(); }
 
-  void Push(const_reference value) { container_.Push_back(value); }
-  void Pop() { container_.Pop_front(); }
-  void Swap(Queue &other) { container_.Swap(other.container_); }
+  void Push(const_reference value) {
+    container_.Push_back(value);
+    latency_.On_enqueue();
+  }
+  void Pop() {
+    container_.Pop_front();
+    latency_.On_dequeue();
+  }
+  void Swap(Queue &other) {
+    container_.Swap(other.container_);
+    latency_.Swap(other.latency_);
+  }
 
   template <typename... Args>
   void Insert_many_back(Args &&...args) {
     container_.Insert_many_back(std::forward<Args>(args)...);
+    for (size_type i = 0; i < sizeof...(Args); ++i) latency_.On_enqueue();
+  }
+
+  QueueStats Stats() const {
+    return QueueStats{container_.Stats(), latency_.Histogram()};
+  }
+
+  // Consuming input range over the queue: each element is popped when the
+  // iterator steps past it, and the range ends once the queue is empty.
+  // It is a std::ranges::view, so std::views adaptors compose with it
+  // lazily. Elements a view skips are popped too, and so is whatever a
+  // view steps over to find its next element: filter | take(n) pops up to
+  // the match after the n-th, while take(n) right after Drain() pops n.
+  class DrainView : public std::ranges::view_interface<DrainView> {
+   public:
+    class Iterator {
+     public:
+      using iterator_concept = std::input_iterator_tag;
+      using value_type = T;
+      using difference_type = std::ptrdiff_t;
+
+      Iterator() = default;
+      explicit Iterator(Queue *queue) : queue_(queue) {}
+      const_reference operator*() const { return queue_->Front(); }
+      Iterator &operator++() {
+        queue_->Pop();
+        return *this;
+      }
+      void operator++(int) { ++*this; }
+      bool operator==(std::default_sentinel_t) const {
+        return queue_->Empty();
+      }
+
+     private:
+      Queue *queue_ = nullptr;
+    };
+
+    DrainView() = default;
+    explicit DrainView(Queue &queue) : queue_(&queue) {}
+    Iterator begin() const { return Iterator(queue_); }
+    std::default_sentinel_t end() const { return std::default_sentinel; }
+
+   private:
+    Queue *queue_ = nullptr;
+  };
+
+  DrainView Drain() { return DrainView(*this); }
+
+  // O(1) read-only view of the queued elements, for containers that can
+  // share their storage (see SnapshotQueue in s21_snapshot_queue.h).
+  auto Snapshot() const
+    requires requires(const Container &c) { c.Snapshot(); }
+  {
+    return container_.Snapshot();
   }
 };
 }  // namespace s21
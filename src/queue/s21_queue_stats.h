@@ -0,0 +1,135 @@
+#ifndef S21_QUEUE_STATS_H
+#define S21_QUEUE_STATS_H
+
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+
+#include "../list/s21_list.h"
+
+namespace s21 {
+// Log-linear histogram in the spirit of HdrHistogram: every power of two is
+// split into kSubBuckets linear buckets, so the relative error of any
+// recorded value stays below 1 / kSubBuckets regardless of magnitude.
+class LatencyHistogram {
+ public:
+  static constexpr unsigned kSubBucketBits = 4;
+  static constexpr size_t kSubBuckets = size_t{1} << kSubBucketBits;
+  static constexpr size_t kBucketCount =
+      (64 - kSubBucketBits + 1) * kSubBuckets;
+
+  void Record(std::chrono::nanoseconds latency) {
+    const uint64_t value =
+        latency.count() > 0 ? static_cast<uint64_t>(latency.count()) : 0;
+    ++buckets_[Bucket_index(value)];
+    if (count_ == 0 || value < min_) min_ = value;
+    if (value > max_) max_ = value;
+    sum_ += value;
+    ++count_;
+  }
+
+  uint64_t Count() const { return count_; }
+  std::chrono::nanoseconds Min() const { return Ns(min_); }
+  std::chrono::nanoseconds Max() const { return Ns(max_); }
+  std::chrono::nanoseconds Mean() const {
+    return Ns(count_ ? sum_ / count_ : 0);
+  }
+
+  // Smallest recorded bucket value such that at least `percentile` percent
+  // of the samples are less than or equal to it.
+  std::chrono::nanoseconds Percentile(double percentile) const {
+    uint64_t result = 0;
+    if (count_ != 0) {
+      if (percentile < 0.0) percentile = 0.0;
+      if (percentile > 100.0) percentile = 100.0;
+      uint64_t target = static_cast<uint64_t>(percentile / 100.0 *
+                                              static_cast<double>(count_));
+      if (target == 0) target = 1;
+      uint64_t seen = 0;
+      size_t index = 0;
+      while (index + 1 < kBucketCount && seen + buckets_[index] < target) {
+        seen += buckets_[index++];
+      }
+      result = Bucket_value(index);
+      if (result < min_) result = min_;
+      if (result > max_) result = max_;
+    }
+    return Ns(result);
+  }
+
+  uint64_t Bucket_count(size_t index) const { return buckets_.at(index); }
+
+  static size_t Bucket_index(uint64_t value) {
+    size_t index = static_cast<size_t>(value);
+    if (value >= kSubBuckets) {
+      const unsigned shift =
+          static_cast<unsigned>(std::bit_width(value)) - 1 - kSubBucketBits;
+      index = (shift + 1) * kSubBuckets +
+              static_cast<size_t>((value >> shift) & (kSubBuckets - 1));
+    }
+    return index;
+  }
+
+  // Lowest value that maps to bucket `index`.
+  static uint64_t Bucket_value(size_t index) {
+    uint64_t value = index;
+    if (index >= kSubBuckets) {
+      const unsigned shift = static_cast<unsigned>(index / kSubBuckets) - 1;
+      value = (kSubBuckets + index % kSubBuckets) << shift;
+    }
+    return value;
+  }
+
+ private:
+  static std::chrono::nanoseconds Ns(uint64_t value) {
+    return std::chrono::nanoseconds(static_cast<int64_t>(value));
+  }
+
+  std::array<uint64_t, kBucketCount> buckets_{};
+  uint64_t count_ = 0;
+  uint64_t min_ = 0;
+  uint64_t max_ = 0;
+  uint64_t sum_ = 0;
+};
+
+struct QueueStats {
+  ContainerStats container;
+  LatencyHistogram latency;
+};
+
+// Enqueue-to-dequeue latency bookkeeping used by Queue. The disabled variant
+// is an empty class, so it occupies no storage and its hooks compile away.
+template <bool Enabled>
+class LatencyTracker {
+ public:
+  void On_enqueue() {}
+  void On_dequeue() {}
+  void Swap(LatencyTracker &) {}
+  LatencyHistogram Histogram() const { return LatencyHistogram(); }
+};
+
+template <>
+class LatencyTracker<true> {
+ public:
+  using clock = std::chrono::steady_clock;
+
+  void On_enqueue() { stamps_.Push_back(clock::now()); }
+  void On_dequeue() {
+    histogram_.Record(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        clock::now() - stamps_.Front()));
+    stamps_.Pop_front();
+  }
+  void Swap(LatencyTracker &other) {
+    stamps_.Swap(other.stamps_);
+    std::swap(histogram_, other.histogram_);
+  }
+  LatencyHistogram Histogram() const { return histogram_; }
+
+ private:
+  List<clock::time_point> stamps_;
+  LatencyHistogram histogram_;
+};
+}  // namespace s21
+
+#endif
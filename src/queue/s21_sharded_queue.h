@@ -0,0 +1,147 @@
+#ifndef S21_SHARDED_QUEUE_H
+#define S21_SHARDED_QUEUE_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <thread>
+
+#include "../list/s21_list.h"
+
+namespace s21 {
+// How much a size query may trade accuracy for speed.
+enum class SizeMode {
+  // Sum of per-shard counters read without locking: cheap, and may be off
+  // while other threads push or pop.
+  kApproximate,
+  // Locks every shard, so the answer is an exact snapshot: steals hold
+  // both shards they move elements between, and none is ever in transit.
+  kStrict,
+};
+
+namespace detail {
+// Small per-thread number used to pick a home shard.
+inline size_t Thread_slot() {
+  static std::atomic<size_t> next{0};
+  thread_local const size_t slot = next.fetch_add(1, std::memory_order_relaxed);
+  return slot;
+}
+}  // namespace detail
+
+// Multi-producer multi-consumer bag of queues: one List-backed shard per
+// thread slot, each on its own cache line with its own lock. Threads push to
+// and pop from their home shard; a thread whose shard is empty steals the
+// older half of another shard, so the owner keeps working on the rest.
+// Order is FIFO per shard, not across the queue.
+template <typename T>
+class ShardedQueue {
+ public:
+  using value_type = T;
+  using const_reference = const T &;
+  using size_type = size_t;
+
+  explicit ShardedQueue(
+      size_type shards = std::thread::hardware_concurrency())
+      : count_(shards ? shards : 1), shards_(new Shard[count_]) {}
+  ShardedQueue(const ShardedQueue &) = delete;
+  ShardedQueue &operator=(const ShardedQueue &) = delete;
+
+  void Push(const_reference value) {
+    Shard &shard = Home();
+    std::lock_guard<std::mutex> guard(shard.lock);
+    shard.items.Push_back(value);
+    shard.size.store(shard.items.Size(), std::memory_order_relaxed);
+  }
+
+  // Takes an element from the home shard, or steals when it is empty.
+  // Returns nothing when no shard looked non-empty; an element pushed
+  // concurrently to another shard may be missed.
+  std::optional<T> Try_pop() {
+    const size_type home = detail::Thread_slot() % count_;
+    std::optional<T> value = Take(shards_[home]);
+    for (size_type step = 1; !value && step < count_; ++step) {
+      value = Steal(shards_[(home + step) % count_], shards_[home]);
+    }
+    return value;
+  }
+
+  size_type Size(SizeMode mode = SizeMode::kApproximate) const {
+    size_type total = 0;
+    if (mode == SizeMode::kStrict) {
+      for (size_type i = 0; i < count_; ++i) shards_[i].lock.lock();
+      for (size_type i = 0; i < count_; ++i) total += shards_[i].items.Size();
+      for (size_type i = count_; i > 0; --i) shards_[i - 1].lock.unlock();
+    } else {
+      for (size_type i = 0; i < count_; ++i) {
+        total += shards_[i].size.load(std::memory_order_relaxed);
+      }
+    }
+    return total;
+  }
+  bool Empty(SizeMode mode = SizeMode::kApproximate) const {
+    return Size(mode) == 0;
+  }
+
+  size_type Shard_count() const { return count_; }
+
+ private:
+  struct alignas(64) Shard {
+    mutable std::mutex lock;
+    List<T> items;
+    std::atomic<size_type> size{0};
+  };
+
+  Shard &Home() { return shards_[detail::Thread_slot() % count_]; }
+
+  static std::optional<T> Take(Shard &shard) {
+    std::lock_guard<std::mutex> guard(shard.lock);
+    return Take_locked(shard);
+  }
+
+  static std::optional<T> Take_locked(Shard &shard) {
+    std::optional<T> value;
+    if (!shard.items.Empty()) {
+      value.emplace(std::move(*shard.items.Begin()));
+      shard.items.Pop_front();
+      shard.size.store(shard.items.Size(), std::memory_order_relaxed);
+    }
+    return value;
+  }
+
+  // Moves the older half of `victim`, at most kMaxSteal elements, to the
+  // end of `home` and pops one element from it. Only the stolen nodes are
+  // walked to find the cut; Split and Splice relink in O(1). Both shards
+  // stay locked until the batch has landed, so a strict Size never misses
+  // it; std::scoped_lock takes the pair without deadlocking against a
+  // thief locking the same two shards the other way round. The relaxed
+  // size hint lets thieves skip empty shards without touching their lock.
+  static std::optional<T> Steal(Shard &victim, Shard &home) {
+    constexpr size_type kMaxSteal = 256;
+    std::optional<T> value;
+    if (victim.size.load(std::memory_order_relaxed) > 0) {
+      std::scoped_lock guard(victim.lock, home.lock);
+      const size_type size = victim.items.Size();
+      const size_type count = std::min((size + 1) / 2, kMaxSteal);
+      if (count > 0) {
+        auto cut = victim.items.Begin();
+        for (size_type i = 0; i < count; ++i) ++cut;
+        List<T> rest = victim.items.Split(cut, size - count);
+        home.items.Splice(home.items.End(), victim.items);
+        victim.items.Splice(victim.items.End(), rest);
+        victim.size.store(victim.items.Size(), std::memory_order_relaxed);
+        value = Take_locked(home);
+      }
+    }
+    return value;
+  }
+
+  const size_type count_;
+  std::unique_ptr<Shard[]> shards_;
+};
+}  // namespace s21
+
+#endif
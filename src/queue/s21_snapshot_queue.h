@@ -0,0 +1,13 @@
+#ifndef S21_SNAPSHOT_QUEUE_H
+#define S21_SNAPSHOT_QUEUE_H
+
+#include "../list/s21_snapshot_list.h"
+#include "s21_queue.h"
+
+namespace s21 {
+// Queue whose Snapshot() costs the same for ten elements or ten million.
+template <typename T, typename StatsPolicy = NoStats>
+using SnapshotQueue = Queue<T, StatsPolicy, SnapshotList<T, StatsPolicy>>;
+}  // namespace s21
+
+#endif
@@ -0,0 +1,183 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../queue/s21_async_queue.h"
+
+template class s21::AsyncQueue<int>;
+namespace s21 {
+namespace {
+
+Task Consume(AsyncQueue<int> &queue, std::vector<int> &out, int count) {
+  for (int i = 0; i < count; ++i) out.push_back(co_await queue.Pop());
+}
+
+Task Consume_one(AsyncQueue<int> &queue, std::vector<int> &out, int id) {
+  int value = co_await queue.Pop();
+  out.push_back(id * 100 + value);
+}
+
+TEST(AsyncQueueTest, BufferedElementsDoNotSuspend) {
+  SingleThreadExecutor executor;
+  AsyncQueue<int> queue(executor);
+  queue.Push(1);
+  queue.Push(2);
+  EXPECT_EQ(queue.Size(), 2U);
+  std::vector<int> out;
+  executor.Spawn(Consume(queue, out, 2));
+  EXPECT_EQ(executor.Run(), 1U);
+  EXPECT_EQ(out, (std::vector<int>{1, 2}));
+  EXPECT_TRUE(queue.Empty());
+}
+
+TEST(AsyncQueueTest, PopSuspendsUntilPush) {
+  SingleThreadExecutor executor;
+  AsyncQueue<int> queue(executor);
+  std::vector<int> out;
+  executor.Spawn(Consume(queue, out, 3));
+  executor.Run();
+  EXPECT_TRUE(out.empty());
+  EXPECT_EQ(queue.Waiting(), 1U);
+
+  queue.Push(7);
+  EXPECT_EQ(queue.Waiting(), 0U);
+  EXPECT_EQ(executor.Run(), 1U);
+  EXPECT_EQ(out, (std::vector<int>{7}));
+
+  queue.Push(8);
+  queue.Push(9);
+  executor.Run();
+  EXPECT_EQ(out, (std::vector<int>{7, 8, 9}));
+  EXPECT_EQ(queue.Waiting(), 0U);
+}
+
+TEST(AsyncQueueTest, PushWakesExactlyOneWaiterInOrder) {
+  SingleThreadExecutor executor;
+  AsyncQueue<int> queue(executor);
+  std::vector<int> out;
+  for (int id = 1; id <= 3; ++id) executor.Spawn(Consume_one(queue, out, id));
+  executor.Run();
+  EXPECT_EQ(queue.Waiting(), 3U);
+
+  queue.Push(5);
+  EXPECT_EQ(executor.Run(), 1U);
+  EXPECT_EQ(out, (std::vector<int>{105}));
+  EXPECT_EQ(queue.Waiting(), 2U);
+
+  queue.Push(6);
+  queue.Push(7);
+  executor.Run();
+  EXPECT_EQ(out, (std::vector<int>{105, 206, 307}));
+}
+
+TEST(AsyncQueueTest, TryPop) {
+  SingleThreadExecutor executor;
+  AsyncQueue<std::string> queue(executor);
+  EXPECT_FALSE(queue.Try_pop().has_value());
+  queue.Push("a");
+  std::string b = "b";
+  queue.Push(b);
+  EXPECT_EQ(queue.Try_pop().value_or(""), "a");
+  EXPECT_EQ(queue.Try_pop().value_or(""), "b");
+  EXPECT_TRUE(queue.Empty());
+}
+
+TEST(AsyncQueueTest, UnstartedTaskIsDestroyed) {
+  SingleThreadExecutor executor;
+  AsyncQueue<int> queue(executor);
+  std::vector<int> out;
+  { Task task = Consume(queue, out, 1); }
+  queue.Push(1);
+  EXPECT_EQ(executor.Run(), 0U);
+  EXPECT_EQ(queue.Size(), 1U);
+}
+
+Task Consume_ptr(AsyncQueue<std::unique_ptr<int>> &queue,
+                 std::vector<int> &out) {
+  std::unique_ptr<int> value = co_await queue.Pop();
+  out.push_back(*value);
+}
+
+TEST(AsyncQueueTest, MoveOnlyElements) {
+  SingleThreadExecutor executor;
+  AsyncQueue<std::unique_ptr<int>> queue(executor);
+  queue.Push(std::make_unique<int>(1));
+  std::vector<int> out;
+  executor.Spawn(Consume_ptr(queue, out));
+  executor.Spawn(Consume_ptr(queue, out));
+  executor.Run();
+  EXPECT_EQ(queue.Waiting(), 1U);
+
+  auto value = std::make_unique<int>(2);
+  queue.Push(std::move(value));
+  executor.Run();
+  EXPECT_EQ(out, (std::vector<int>{1, 2}));
+
+  queue.Push(std::make_unique<int>(3));
+  EXPECT_EQ(*queue.Try_pop().value(), 3);
+}
+
+Task Add_to(AsyncQueue<int> &queue, std::shared_ptr<int> total) {
+  *total += co_await queue.Pop();
+}
+
+TEST(AsyncQueueTest, TeardownDestroysSuspendedCoroutines) {
+  auto total = std::make_shared<int>(0);
+  {
+    SingleThreadExecutor executor;
+    {
+      AsyncQueue<int> queue(executor);
+      executor.Spawn(Add_to(queue, total));
+      executor.Spawn(Add_to(queue, total));
+      executor.Run();
+      EXPECT_EQ(queue.Waiting(), 2U);
+      EXPECT_EQ(total.use_count(), 3);
+    }
+    EXPECT_EQ(total.use_count(), 1);
+
+    AsyncQueue<int> queue(executor);
+    executor.Spawn(Add_to(queue, total));
+    EXPECT_EQ(total.use_count(), 2);
+  }
+  EXPECT_EQ(total.use_count(), 1);
+  EXPECT_EQ(*total, 0);
+}
+
+Task Sum_consumer(AsyncQueue<int> &queue, std::atomic<long> &sum,
+                  std::atomic<int> &done, int count) {
+  for (int i = 0; i < count; ++i) sum += co_await queue.Pop();
+  ++done;
+}
+
+TEST(AsyncQueueTest, ThreadPoolManyConsumersAndProducers) {
+  constexpr int kConsumers = 1000;
+  constexpr int kPerConsumer = 20;
+  constexpr int kProducers = 4;
+  std::atomic<long> sum{0};
+  std::atomic<int> done{0};
+  {
+    ThreadPoolExecutor executor(4);
+    AsyncQueue<int> queue(executor);
+    for (int i = 0; i < kConsumers; ++i) {
+      executor.Spawn(Sum_consumer(queue, sum, done, kPerConsumer));
+    }
+    std::vector<std::thread> producers;
+    for (int p = 0; p < kProducers; ++p) {
+      producers.emplace_back([&queue] {
+        for (int i = 0; i < kConsumers * kPerConsumer / kProducers; ++i) {
+          queue.Push(1);
+        }
+      });
+    }
+    for (auto &producer : producers) producer.join();
+    while (done.load() < kConsumers) std::this_thread::yield();
+  }
+  EXPECT_EQ(sum.load(), static_cast<long>(kConsumers) * kPerConsumer);
+}
+
+}  // namespace
+}  // namespace s21
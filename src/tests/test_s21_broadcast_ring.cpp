@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../queue/s21_broadcast_ring.h"
+
+template class s21::BroadcastRing<int>;
+namespace s21 {
+namespace {
+
+std::vector<int> Read_all(BroadcastRing<int>::Subscriber &subscriber) {
+  std::vector<int> values;
+  subscriber.Poll([&values](const int &value) { values.push_back(value); });
+  return values;
+}
+
+TEST(BroadcastRingTest, EverySubscriberSeesEveryElement) {
+  BroadcastRing<int> ring(5);
+  EXPECT_EQ(ring.Capacity(), 8U);
+  auto first = ring.Subscribe();
+  auto second = ring.Subscribe();
+  EXPECT_EQ(ring.Subscriber_count(), 2U);
+
+  ring.Publish(1);
+  ring.Publish(3, [](int &slot, size_t i) { slot = static_cast<int>(i) + 2; });
+  EXPECT_EQ(ring.Published(), 4U);
+  EXPECT_EQ(first.Lag(), 4U);
+  EXPECT_EQ(Read_all(first), (std::vector<int>{1, 2, 3, 4}));
+  EXPECT_EQ(first.Lag(), 0U);
+  EXPECT_TRUE(Read_all(first).empty());
+
+  std::vector<int> partial;
+  EXPECT_EQ(second.Poll([&partial](const int &v) { partial.push_back(v); }, 3),
+            3U);
+  EXPECT_EQ(partial, (std::vector<int>{1, 2, 3}));
+  EXPECT_EQ(Read_all(second), (std::vector<int>{4}));
+}
+
+TEST(BroadcastRingTest, SlowestSubscriberGatesProducers) {
+  BroadcastRing<int> ring(4);
+  auto fast = ring.Subscribe();
+  auto slow = ring.Subscribe();
+  for (int i = 0; i < 4; ++i) EXPECT_TRUE(ring.Try_publish(i));
+  Read_all(fast);
+  EXPECT_FALSE(ring.Try_publish(4));
+
+  EXPECT_EQ(slow.Poll([](const int &) {}, 1), 1U);
+  EXPECT_TRUE(ring.Try_publish(4));
+  EXPECT_FALSE(ring.Try_publish(5));
+  EXPECT_EQ(Read_all(slow), (std::vector<int>{1, 2, 3, 4}));
+  EXPECT_EQ(Read_all(fast), (std::vector<int>{4}));
+}
+
+TEST(BroadcastRingTest, OversizedBatchIsRejected) {
+  BroadcastRing<int> ring(4);
+  auto subscriber = ring.Subscribe();
+  auto fill = [](int &slot, size_t i) { slot = static_cast<int>(i); };
+  EXPECT_THROW(ring.Publish(5, fill), std::length_error);
+  // Nothing was claimed, so a full-size batch still goes through.
+  ring.Publish(4, fill);
+  EXPECT_EQ(Read_all(subscriber), (std::vector<int>{0, 1, 2, 3}));
+  EXPECT_EQ(ring.Published(), 4U);
+}
+
+TEST(BroadcastRingTest, LeavingReleasesTheGate) {
+  BroadcastRing<std::string> ring(2);
+  auto reader = ring.Subscribe();
+  {
+    auto idle = ring.Subscribe();
+    EXPECT_TRUE(ring.Try_publish("a"));
+    EXPECT_TRUE(ring.Try_publish("b"));
+    reader.Poll([](const std::string &) {});
+    EXPECT_FALSE(ring.Try_publish("c"));
+  }
+  EXPECT_EQ(ring.Subscriber_count(), 1U);
+  EXPECT_TRUE(ring.Try_publish("c"));
+
+  auto late = ring.Subscribe();
+  EXPECT_EQ(late.Lag(), 0U);
+  ring.Publish("d");
+  std::string seen;
+  late.Poll([&seen](const std::string &value) { seen += value; });
+  EXPECT_EQ(seen, "d");
+}
+
+TEST(BroadcastRingTest, ConcurrentProducersAndSubscribers) {
+  constexpr int kProducers = 3;
+  constexpr int kSubscribers = 3;
+  constexpr int kBatches = 2000;
+  constexpr int kBatch = 5;
+  constexpr uint64_t kTotal = uint64_t{kProducers} * kBatches * kBatch;
+  BroadcastRing<int> ring(16);
+
+  std::vector<BroadcastRing<int>::Subscriber> subscribers;
+  for (int s = 0; s < kSubscribers; ++s) {
+    subscribers.push_back(ring.Subscribe());
+  }
+  std::vector<long> sums(kSubscribers, 0);
+  std::vector<std::thread> threads;
+  for (int s = 0; s < kSubscribers; ++s) {
+    threads.emplace_back([&, s] {
+      uint64_t seen = 0;
+      while (seen < kTotal) {
+        size_t n = subscribers[s].Poll(
+            [&](const int &value) { sums[s] += value; });
+        seen += n;
+        if (n == 0) std::this_thread::yield();
+      }
+    });
+  }
+  for (int p = 0; p < kProducers; ++p) {
+    threads.emplace_back([&ring] {
+      for (int b = 0; b < kBatches; ++b) {
+        ring.Publish(kBatch, [](int &slot, size_t i) {
+          slot = static_cast<int>(i) + 1;
+        });
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+  for (long sum : sums) {
+    EXPECT_EQ(sum, static_cast<long>(kProducers) * kBatches * 15);
+  }
+  EXPECT_EQ(ring.Published(), kTotal);
+}
+
+}  // namespace
+}  // namespace s21
@@ -0,0 +1,202 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <random>
+#include <ranges>
+#include <stdexcept>
+#include <vector>
+
+#include "../list/s21_compressed_list.h"
+#include "../queue/s21_compressed_queue.h"
+
+template class s21::CompressedList<uint64_t>;
+template class s21::CompressedList<int16_t>;
+namespace s21 {
+namespace {
+
+template <typename T>
+std::vector<T> Values(const CompressedList<T> &list) {
+  return std::vector<T>(list.begin(), list.end());
+}
+
+// Pushes `values` one by one, checking contents and size on the way.
+template <typename T>
+void Round_trip(const std::vector<T> &values) {
+  CompressedList<T> list;
+  for (T value : values) list.Push_back(value);
+  ASSERT_EQ(list.Size(), values.size());
+  ASSERT_EQ(Values(list), values);
+  if (!values.empty()) {
+    EXPECT_EQ(list.Back(), values.back());
+  }
+}
+
+TEST(CompressedListTest, PushPopFifo) {
+  static_assert(std::ranges::forward_range<CompressedList<int>>);
+  CompressedList<int> list = {3, 1, 2};
+  EXPECT_EQ(list.Front(), 3);
+  EXPECT_EQ(list.Back(), 2);
+  list.Pop_front();
+  EXPECT_EQ(Values(list), (std::vector<int>{1, 2}));
+  list.Pop_front();
+  list.Pop_front();
+  EXPECT_TRUE(list.Empty());
+  EXPECT_EQ(list.begin(), list.end());
+  EXPECT_THROW(list.Front(), std::out_of_range);
+  EXPECT_THROW(list.Pop_front(), std::out_of_range);
+}
+
+TEST(CompressedListTest, RoundTripsAnyValues) {
+  std::mt19937_64 rng(11);
+  std::vector<uint64_t> sorted;
+  std::vector<uint64_t> random;
+  std::vector<uint64_t> constant(1000, 42);
+  std::vector<uint64_t> extremes;
+  uint64_t now = 1700000000000000;
+  for (int i = 0; i < 5000; ++i) {
+    sorted.push_back(now += rng() % 1000);
+    random.push_back(rng());
+    extremes.push_back(i % 2 ? 0 : std::numeric_limits<uint64_t>::max());
+  }
+  Round_trip(sorted);
+  Round_trip(random);
+  Round_trip(constant);
+  Round_trip(extremes);
+
+  std::vector<int16_t> small;
+  std::vector<int64_t> jitter;
+  for (int i = 0; i < 3000; ++i) {
+    small.push_back(static_cast<int16_t>(rng()));
+    jitter.push_back(i * 10 - 7000 + static_cast<int64_t>(rng() % 25) - 12);
+  }
+  Round_trip(small);
+  Round_trip(jitter);
+}
+
+TEST(CompressedListTest, SortedDataIsSmall) {
+  CompressedList<uint64_t> list;
+  uint64_t now = 1700000000000000;
+  for (int i = 0; i < 128 * 100; ++i) list.Push_back(now += 1000 + i % 7);
+  // About 12 bits per value plus a block header every 128 values.
+  EXPECT_LT(list.Bytes_used(), list.Size() * 2 + 4096);
+  list.Clear();
+  EXPECT_EQ(list.Bytes_used(), 0U);
+}
+
+TEST(CompressedListTest, MatchesDequeUnderMixedUse) {
+  std::mt19937 rng(4);
+  CompressedList<int32_t> list;
+  std::deque<int32_t> model;
+  int32_t next = 0;
+  for (int step = 0; step < 100000; ++step) {
+    if (rng() % 5 < 3) {
+      next += static_cast<int32_t>(rng() % 100) - 30;
+      list.Push_back(next);
+      model.push_back(next);
+    } else if (!model.empty()) {
+      ASSERT_EQ(list.Front(), model.front());
+      list.Pop_front();
+      model.pop_front();
+    }
+    ASSERT_EQ(list.Size(), model.size());
+  }
+  EXPECT_TRUE(std::ranges::equal(list, model));
+}
+
+TEST(CompressedListTest, IteratorCopiesAreIndependent) {
+  CompressedList<uint32_t> list;
+  for (uint32_t i = 0; i < 1000; ++i) list.Push_back(i * 3);
+  list.Pop_front();
+  auto it = list.begin();
+  for (int i = 0; i < 300; ++i) ++it;
+  auto copy = it;
+  const uint32_t &seen = *copy;
+  for (int i = 0; i < 300; ++i) ++it;
+  EXPECT_EQ(seen, 903U);
+  EXPECT_EQ(*it, 1803U);
+  EXPECT_EQ(std::ranges::distance(copy, list.end()), 699);
+}
+
+TEST(CompressedListTest, MergeCopyAndSwap) {
+  CompressedList<uint64_t> evens;
+  CompressedList<uint64_t> odds;
+  for (uint64_t i = 0; i < 600; i += 2) evens.Push_back(i);
+  for (uint64_t i = 1; i < 400; i += 2) odds.Push_back(i);
+  evens.Merge(odds);
+  EXPECT_TRUE(odds.Empty());
+  std::vector<uint64_t> expected;
+  for (uint64_t i = 0; i < 400; ++i) expected.push_back(i);
+  for (uint64_t i = 400; i < 600; i += 2) expected.push_back(i);
+  EXPECT_EQ(Values(evens), expected);
+
+  CompressedList<uint64_t> copy(evens);
+  copy.Pop_front();
+  EXPECT_EQ(copy.Size(), evens.Size() - 1);
+  copy.Swap(evens);
+  EXPECT_EQ(copy.Front(), 0U);
+  copy = evens;
+  EXPECT_EQ(Values(copy), Values(evens));
+}
+
+TEST(CompressedListTest, MergeKeepsStats) {
+  CompressedList<uint64_t, CountingStats> evens;
+  CompressedList<uint64_t, CountingStats> odds;
+  for (uint64_t i = 0; i < 600; i += 2) evens.Push_back(i);
+  for (uint64_t i = 1; i < 400; i += 2) odds.Push_back(i);
+  ASSERT_EQ(evens.Stats().allocations, 1U);
+  evens.Merge(odds);
+  // 500 elements re-encoded: a head buffer, two blocks and the tail. The
+  // one block of the old contents is gone.
+  ContainerStats stats = evens.Stats();
+  EXPECT_EQ(stats.allocations, 3U);
+  EXPECT_EQ(stats.frees, 1U);
+  EXPECT_EQ(stats.pushes, 800U);
+  EXPECT_EQ(stats.max_size, 500U);
+  EXPECT_EQ(stats.merge_calls, 1U);
+  evens.Clear();
+  EXPECT_EQ(evens.Stats().frees, evens.Stats().allocations);
+  EXPECT_EQ(odds.Stats().pushes, 200U);
+}
+
+TEST(CompressedListTest, QueueBackend) {
+  CompressedQueue<uint64_t> queue = {5, 6};
+  for (uint64_t i = 7; i < 1000; ++i) queue.Push(i);
+  EXPECT_EQ(queue.Size(), 995U);
+  EXPECT_EQ(queue.Back(), 999U);
+  uint64_t expected = 5;
+  for (uint64_t value : queue.Drain() | std::views::take(500)) {
+    EXPECT_EQ(value, expected++);
+  }
+  EXPECT_EQ(queue.Front(), 505U);
+  queue.Insert_many_back(uint64_t{1000}, uint64_t{1001});
+  EXPECT_EQ(queue.Size(), 497U);
+}
+
+#ifdef S21_SIMD_X86
+TEST(CompressedListTest, Avx2DecodeMatchesScalar) {
+  if (!detail::simd::Has_avx2()) GTEST_SKIP() << "no AVX2";
+  std::mt19937_64 rng(8);
+  for (unsigned bits = 0; bits <= 64; ++bits) {
+    uint64_t values[detail::packed::kBlock];
+    uint64_t value = rng();
+    for (auto &v : values) {
+      v = value += bits == 64 ? rng() : rng() & ((uint64_t{1} << bits) - 1);
+    }
+    uint64_t words[detail::packed::Words(64)] = {};
+    unsigned width = detail::packed::Pack(values, values[0], words);
+    uint64_t scalar[detail::packed::kBlock];
+    uint64_t vector[detail::packed::kBlock];
+    detail::packed::Unpack_scalar(words, width, values[0], scalar);
+    detail::packed::Unpack_avx2(words, width, values[0], vector);
+    for (size_t i = 0; i < detail::packed::kBlock; ++i) {
+      ASSERT_EQ(scalar[i], values[i]) << bits;
+      ASSERT_EQ(vector[i], values[i]) << bits;
+    }
+  }
+}
+#endif
+
+}  // namespace
+}  // namespace s21
@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../list/s21_concurrent_list.h"
+
+template class s21::ConcurrentList<int>;
+namespace s21 {
+namespace {
+
+std::vector<int> Contents(const ConcurrentList<int> &list) {
+  std::vector<int> values;
+  list.For_each([&values](const int &value) { values.push_back(value); });
+  return values;
+}
+
+TEST(ConcurrentListTest, KeepsSortedUniqueElements) {
+  ConcurrentList<int> list = {5, 1, 3, 3};
+  EXPECT_EQ(list.Size(), 3U);
+  EXPECT_TRUE(list.Insert(4));
+  EXPECT_FALSE(list.Insert(1));
+  EXPECT_EQ(Contents(list), (std::vector<int>{1, 3, 4, 5}));
+}
+
+TEST(ConcurrentListTest, EraseAndFind) {
+  ConcurrentList<int> list = {1, 2, 3};
+  EXPECT_TRUE(list.Erase(2));
+  EXPECT_FALSE(list.Erase(2));
+  EXPECT_FALSE(list.Contains(2));
+  EXPECT_TRUE(list.Contains(3));
+  EXPECT_EQ(list.Find(1).value_or(-1), 1);
+  EXPECT_FALSE(list.Find(7).has_value());
+  EXPECT_TRUE(list.Erase(1));
+  EXPECT_TRUE(list.Erase(3));
+  EXPECT_TRUE(list.Empty());
+  EXPECT_TRUE(Contents(list).empty());
+}
+
+TEST(ConcurrentListTest, NonDefaultConstructibleValues) {
+  struct Session {
+    explicit Session(int session_id) : id(session_id) {}
+    bool operator<(const Session &other) const { return id < other.id; }
+    int id;
+  };
+  ConcurrentList<Session> sessions;
+  sessions.Insert(Session(2));
+  sessions.Insert(Session(1));
+  EXPECT_EQ(sessions.Find(Session(2))->id, 2);
+}
+
+// Copies throw while `fail` is set.
+struct Fragile {
+  explicit Fragile(int fragile_id) : id(fragile_id) {}
+  Fragile(const Fragile &other) : id(other.id) {
+    if (fail) throw std::runtime_error("copy failed");
+  }
+  Fragile &operator=(const Fragile &) = default;
+  bool operator<(const Fragile &other) const { return id < other.id; }
+  static inline bool fail = false;
+  int id;
+};
+
+TEST(ConcurrentListTest, ThrowingOperationsReleaseLocks) {
+  ConcurrentList<Fragile> list;
+  list.Insert(Fragile(1));
+  list.Insert(Fragile(3));
+  Fragile::fail = true;
+  EXPECT_THROW(list.Insert(Fragile(2)), std::runtime_error);
+  EXPECT_THROW(list.Find(Fragile(3)), std::runtime_error);
+  Fragile::fail = false;
+  auto visit = [](const Fragile &item) {
+    if (item.id == 1) throw std::runtime_error("visit failed");
+  };
+  EXPECT_THROW(list.For_each(visit), std::runtime_error);
+  // Every lock was given back, so the whole list is still reachable.
+  EXPECT_TRUE(list.Contains(Fragile(3)));
+  EXPECT_TRUE(list.Insert(Fragile(2)));
+  EXPECT_TRUE(list.Erase(Fragile(1)));
+  EXPECT_EQ(list.Size(), 2U);
+}
+
+TEST(ConcurrentListTest, ParallelInsertEraseContains) {
+  ConcurrentList<int> list;
+  constexpr int kThreads = 4;
+  constexpr int kPerThread = 500;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&list, t] {
+      for (int i = 0; i < kPerThread; ++i) {
+        int key = i * kThreads + t;
+        EXPECT_TRUE(list.Insert(key));
+        EXPECT_TRUE(list.Contains(key));
+        if (i % 2) {
+          EXPECT_TRUE(list.Erase(key));
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+
+  std::vector<int> values = Contents(list);
+  ASSERT_EQ(values.size(), static_cast<size_t>(kThreads * kPerThread / 2));
+  EXPECT_EQ(list.Size(), values.size());
+  for (size_t i = 1; i < values.size(); ++i) {
+    EXPECT_LT(values[i - 1], values[i]);
+  }
+  for (int value : values) EXPECT_EQ((value / kThreads) % 2, 0);
+}
+
+}  // namespace
+}  // namespace s21
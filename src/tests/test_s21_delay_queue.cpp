@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../queue/s21_delay_queue.h"
+
+template class s21::DelayQueue<int>;
+namespace s21 {
+namespace {
+
+using Timers = DelayQueue<int>;
+
+std::vector<int> Values(const List<Timers::Entry> &out) {
+  std::vector<int> values;
+  for (auto it = out.Cbegin(); it != out.Cend(); ++it) {
+    values.push_back(it->value);
+  }
+  return values;
+}
+
+TEST(DelayQueueTest, FiresInDeadlineOrder) {
+  Timers timers;
+  timers.Schedule(30, 3);
+  timers.Schedule(10, 1);
+  timers.Schedule(20, 2);
+  EXPECT_EQ(timers.Size(), 3U);
+
+  List<Timers::Entry> out;
+  EXPECT_EQ(timers.Pop_expired(9, out), 0U);
+  EXPECT_EQ(timers.Now(), 9U);
+  EXPECT_EQ(timers.Pop_expired(20, out), 2U);
+  EXPECT_EQ(Values(out), (std::vector<int>{1, 2}));
+  EXPECT_EQ(timers.Pop_expired(1000, out), 1U);
+  EXPECT_EQ(Values(out), (std::vector<int>{1, 2, 3}));
+  EXPECT_EQ(out.Back().deadline, 30U);
+  EXPECT_TRUE(timers.Empty());
+}
+
+TEST(DelayQueueTest, PastDeadlinesFireOnNextPop) {
+  Timers timers(100);
+  timers.Schedule(50, 1);
+  timers.Schedule(100, 2);
+  List<Timers::Entry> out;
+  EXPECT_EQ(timers.Pop_expired(100, out), 2U);
+  EXPECT_EQ(out.Front().deadline, 50U);
+  EXPECT_EQ(timers.Pop_expired(50, out), 0U);
+  EXPECT_EQ(timers.Now(), 100U);
+}
+
+TEST(DelayQueueTest, CancelAndReschedule) {
+  Timers timers;
+  auto a = timers.Schedule(5000, 1);
+  auto b = timers.Schedule(70, 2);
+  auto c = timers.Schedule(1 << 20, 3);
+  timers.Cancel(b);
+  timers.Reschedule(c, 10);
+  timers.Reschedule(a, 1 << 30);
+  EXPECT_EQ(timers.Size(), 2U);
+
+  List<Timers::Entry> out;
+  EXPECT_EQ(timers.Pop_expired(1 << 29, out), 1U);
+  EXPECT_EQ(Values(out), (std::vector<int>{3}));
+  timers.Cancel(a);
+  EXPECT_TRUE(timers.Empty());
+  EXPECT_EQ(timers.Pop_expired(uint64_t{1} << 40, out), 0U);
+}
+
+TEST(DelayQueueTest, FarDeadlines) {
+  Timers timers;
+  const uint64_t far = ~uint64_t{0} - 5;
+  timers.Schedule(far, 1);
+  timers.Schedule(uint64_t{1} << 50, 2);
+  List<Timers::Entry> out;
+  EXPECT_EQ(timers.Pop_expired(far - 1, out), 1U);
+  EXPECT_EQ(Values(out), (std::vector<int>{2}));
+  EXPECT_EQ(timers.Pop_expired(far, out), 1U);
+  EXPECT_EQ(out.Back().deadline, far);
+}
+
+TEST(DelayQueueTest, MatchesSortedModel) {
+  std::mt19937_64 rng(5);
+  Timers timers;
+  std::vector<std::pair<uint64_t, int>> pending;
+  std::vector<Timers::Handle> handles;
+  for (int i = 0; i < 5000; ++i) {
+    uint64_t deadline = rng() % 200000;
+    handles.push_back(timers.Schedule(deadline, i));
+    pending.emplace_back(deadline, i);
+  }
+  for (int i = 0; i < 5000; i += 7) {
+    timers.Cancel(handles[i]);
+    pending[i].second = -1;
+  }
+  std::erase_if(pending, [](const auto &p) { return p.second < 0; });
+
+  uint64_t now = 0;
+  while (!pending.empty()) {
+    now += rng() % 3000;
+    List<Timers::Entry> out;
+    timers.Pop_expired(now, out);
+    std::vector<int> expected;
+    for (const auto &p : pending) {
+      if (p.first <= now) expected.push_back(p.second);
+    }
+    std::erase_if(pending, [now](const auto &p) { return p.first <= now; });
+    std::vector<int> fired = Values(out);
+    for (auto it = out.Cbegin(); it != out.Cend(); ++it) {
+      EXPECT_LE(it->deadline, now);
+    }
+    std::sort(fired.begin(), fired.end());
+    std::sort(expected.begin(), expected.end());
+    ASSERT_EQ(fired, expected);
+    EXPECT_EQ(timers.Size(), pending.size());
+  }
+}
+
+TEST(DelayQueueTest, NonTrivialValues) {
+  DelayQueue<std::string> timers;
+  timers.Schedule(3, "retry");
+  auto handle = timers.Schedule(4, "dropped");
+  handle->value = "edited";
+  List<DelayQueue<std::string>::Entry> out;
+  timers.Pop_expired(10, out);
+  EXPECT_EQ(out.Front().value, "retry");
+  EXPECT_EQ(out.Back().value, "edited");
+}
+
+}  // namespace
+}  // namespace s21
@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../queue/s21_fair_scheduler.h"
+
+template class s21::FairScheduler<int, int>;
+namespace s21 {
+namespace {
+
+std::vector<std::string> Drain(FairScheduler<char, std::string> &scheduler) {
+  std::vector<std::string> order;
+  while (auto value = scheduler.Dequeue()) order.push_back(*value);
+  return order;
+}
+
+TEST(FairSchedulerTest, RoundRobinOverEqualWeights) {
+  FairScheduler<char, std::string> scheduler;
+  EXPECT_FALSE(scheduler.Dequeue().has_value());
+  scheduler.Enqueue('a', "a1");
+  scheduler.Enqueue('a', "a2");
+  scheduler.Enqueue('a', "a3");
+  scheduler.Enqueue('b', "b1");
+  scheduler.Enqueue('c', "c1");
+  scheduler.Enqueue('c', "c2");
+  EXPECT_EQ(scheduler.Size(), 6U);
+  EXPECT_EQ(scheduler.Size('a'), 3U);
+  EXPECT_EQ(scheduler.Active_count(), 3U);
+  EXPECT_EQ(Drain(scheduler), (std::vector<std::string>{"a1", "b1", "c1",
+                                                         "a2", "c2", "a3"}));
+  EXPECT_TRUE(scheduler.Empty());
+  EXPECT_EQ(scheduler.Active_count(), 0U);
+}
+
+TEST(FairSchedulerTest, WeightsSetTheShare) {
+  FairScheduler<char, std::string> scheduler;
+  scheduler.Set_weight('a', 3);
+  EXPECT_EQ(scheduler.Weight('a'), 3U);
+  EXPECT_EQ(scheduler.Weight('z'), 1U);
+  for (int i = 0; i < 4; ++i) {
+    scheduler.Enqueue('a', "a");
+    scheduler.Enqueue('b', "b");
+  }
+  EXPECT_EQ(Drain(scheduler), (std::vector<std::string>{"a", "a", "a", "b",
+                                                         "a", "b", "b", "b"}));
+  EXPECT_THROW(scheduler.Set_weight('a', 0), std::invalid_argument);
+  EXPECT_THROW((FairScheduler<int, int>(0)), std::invalid_argument);
+}
+
+TEST(FairSchedulerTest, KeyRejoinsAtTheBack) {
+  FairScheduler<char, std::string> scheduler(2);
+  scheduler.Enqueue('a', "a1");
+  scheduler.Enqueue('b', "b1");
+  scheduler.Enqueue('b', "b2");
+  scheduler.Enqueue('b', "b3");
+  EXPECT_EQ(*scheduler.Dequeue(), "a1");
+  scheduler.Enqueue('a', "a2");
+  EXPECT_EQ(Drain(scheduler),
+            (std::vector<std::string>{"b1", "b2", "a2", "b3"}));
+}
+
+TEST(FairSchedulerTest, BackloggedKeysShareInProportion) {
+  FairScheduler<int, int> scheduler;
+  for (int key = 0; key < 50; ++key) {
+    scheduler.Set_weight(key, key % 5 + 1);
+    for (int i = 0; i < 100; ++i) scheduler.Enqueue(key, key);
+  }
+  std::map<int, int> served;
+  for (int i = 0; i < 10 * 150; ++i) ++served[*scheduler.Dequeue()];
+  for (int key = 0; key < 50; ++key) {
+    EXPECT_EQ(served[key], 10 * (key % 5 + 1));
+  }
+}
+
+// Counts copies, and throws on a copy while `fail` is set.
+struct Tracked {
+  static inline bool fail = false;
+  static inline int copies = 0;
+  int id = 0;
+  explicit Tracked(int value) : id(value) {}
+  Tracked(const Tracked &other) : id(other.id) {
+    if (fail) throw std::runtime_error("copy failed");
+    ++copies;
+  }
+  Tracked(Tracked &&other) noexcept : id(other.id) {}
+  Tracked &operator=(const Tracked &) = default;
+  Tracked &operator=(Tracked &&) noexcept = default;
+};
+
+TEST(FairSchedulerTest, ThrowingEnqueueLeavesNothingBehind) {
+  FairScheduler<char, Tracked> scheduler;
+  scheduler.Enqueue('a', Tracked(1));
+  Tracked::fail = true;
+  EXPECT_THROW(scheduler.Enqueue('b', Tracked(2)), std::runtime_error);
+  EXPECT_THROW(scheduler.Enqueue('a', Tracked(3)), std::runtime_error);
+  Tracked::fail = false;
+  EXPECT_EQ(scheduler.Size(), 1U);
+  EXPECT_EQ(scheduler.Active_count(), 1U);
+  EXPECT_EQ(scheduler.Size('b'), 0U);
+
+  scheduler.Enqueue('b', Tracked(4));
+  EXPECT_EQ(scheduler.Dequeue()->id, 1);
+  EXPECT_EQ(scheduler.Dequeue()->id, 4);
+  EXPECT_FALSE(scheduler.Dequeue().has_value());
+  EXPECT_EQ(scheduler.Active_count(), 0U);
+}
+
+TEST(FairSchedulerTest, DequeueMovesTheElementOut) {
+  FairScheduler<int, Tracked> scheduler;
+  scheduler.Enqueue(0, Tracked(7));
+  Tracked::copies = 0;
+  std::optional<Tracked> value = scheduler.Dequeue();
+  ASSERT_TRUE(value.has_value());
+  EXPECT_EQ(value->id, 7);
+  EXPECT_EQ(Tracked::copies, 0);
+}
+
+}  // namespace
+}  // namespace s21
@@ -0,0 +1,189 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <list>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../list/s21_indexed_list.h"
+
+template class s21::IndexedList<int>;
+namespace s21 {
+namespace {
+
+std::vector<int> Contents(const IndexedList<int> &list) {
+  std::vector<int> values;
+  for (auto it = list.Cbegin(); it != list.Cend(); ++it) values.push_back(*it);
+  return values;
+}
+
+// Every position must round-trip through At and Index_of.
+void ExpectIndexConsistent(IndexedList<int> &list) {
+  size_t k = 0;
+  for (auto it = list.Begin(); it != list.End(); ++it, ++k) {
+    EXPECT_EQ(list.Index_of(it), k);
+    EXPECT_EQ(&list.At(k), &*it);
+  }
+  EXPECT_EQ(k, list.Size());
+  EXPECT_EQ(list.Index_of(list.End()), list.Size());
+}
+
+TEST(IndexedListTest, BehavesLikeList) {
+  IndexedList<int> list = {2, 3};
+  list.Push_front(1);
+  list.Push_back(4);
+  EXPECT_EQ(list.Front(), 1);
+  EXPECT_EQ(list.Back(), 4);
+  list.Pop_front();
+  list.Pop_back();
+  EXPECT_EQ(Contents(list), (std::vector<int>{2, 3}));
+  auto it = list.Insert(++list.Begin(), 7);
+  EXPECT_EQ(*it, 7);
+  EXPECT_EQ(Contents(list), (std::vector<int>{2, 7, 3}));
+  list.Erase(list.Begin());
+  EXPECT_EQ(Contents(list), (std::vector<int>{7, 3}));
+  EXPECT_THROW(list.Erase(list.End()), std::out_of_range);
+  list.Clear();
+  EXPECT_TRUE(list.Empty());
+  EXPECT_THROW(list.Front(), std::out_of_range);
+  EXPECT_THROW(list.Pop_back(), std::out_of_range);
+}
+
+TEST(IndexedListTest, CopyMoveAndSwap) {
+  IndexedList<int> a = {1, 2, 3};
+  IndexedList<int> b(a);
+  EXPECT_EQ(Contents(b), Contents(a));
+  IndexedList<int> c(std::move(a));
+  EXPECT_TRUE(a.Empty());
+  EXPECT_EQ(Contents(c), (std::vector<int>{1, 2, 3}));
+  IndexedList<int> d = {9};
+  d.Swap(c);
+  EXPECT_EQ(Contents(d), (std::vector<int>{1, 2, 3}));
+  EXPECT_EQ(Contents(c), (std::vector<int>{9}));
+  c = std::move(d);
+  EXPECT_EQ(c.At(2), 3);
+}
+
+TEST(IndexedListTest, AtAndIndexOf) {
+  IndexedList<int> list;
+  for (int i = 0; i < 1000; ++i) list.Push_back(i * 10);
+  for (size_t k = 0; k < list.Size(); k += 37) {
+    EXPECT_EQ(list.At(k), static_cast<int>(k) * 10);
+  }
+  EXPECT_THROW(list.At(1000), std::out_of_range);
+  const IndexedList<int> &view = list;
+  EXPECT_EQ(view.At(999), 9990);
+  ExpectIndexConsistent(list);
+}
+
+TEST(IndexedListTest, Advance) {
+  IndexedList<int> list = {0, 1, 2, 3, 4, 5};
+  auto it = list.Advance(list.Begin(), 4);
+  EXPECT_EQ(*it, 4);
+  EXPECT_EQ(*list.Advance(it, -3), 1);
+  EXPECT_EQ(list.Advance(it, 2), list.End());
+  EXPECT_EQ(*list.Advance(list.End(), -1), 5);
+  EXPECT_THROW(list.Advance(it, 3), std::out_of_range);
+  EXPECT_THROW(list.Advance(list.Begin(), -1), std::out_of_range);
+}
+
+TEST(IndexedListTest, BoundsAndInsertSorted) {
+  IndexedList<int> list;
+  std::mt19937 rng(7);
+  std::vector<int> expected;
+  for (int i = 0; i < 500; ++i) {
+    int value = static_cast<int>(rng() % 100);
+    list.Insert_sorted(value);
+    expected.insert(std::upper_bound(expected.begin(), expected.end(), value),
+                    value);
+  }
+  EXPECT_EQ(Contents(list), expected);
+  ExpectIndexConsistent(list);
+
+  for (int value = -1; value <= 100; ++value) {
+    size_t lower = std::lower_bound(expected.begin(), expected.end(), value) -
+                   expected.begin();
+    size_t upper = std::upper_bound(expected.begin(), expected.end(), value) -
+                   expected.begin();
+    EXPECT_EQ(list.Index_of(list.Lower_bound(value)), lower);
+    EXPECT_EQ(list.Index_of(list.Upper_bound(value)), upper);
+  }
+}
+
+TEST(IndexedListTest, InsertSortedIsStable) {
+  IndexedList<std::string> list;
+  list.Insert_sorted("b");
+  auto first = list.Insert_sorted("a");
+  auto second = list.Insert_sorted("a");
+  EXPECT_EQ(list.Index_of(first), 0U);
+  EXPECT_EQ(list.Index_of(second), 1U);
+}
+
+TEST(IndexedListTest, IteratorsSurviveUpdates) {
+  IndexedList<int> list = {10, 20, 30};
+  auto it = ++list.Begin();
+  for (int i = 0; i < 100; ++i) list.Push_front(i);
+  list.Erase(list.Begin());
+  EXPECT_EQ(*it, 20);
+  EXPECT_EQ(list.Index_of(it), 100U);
+}
+
+TEST(IndexedListTest, Splice) {
+  IndexedList<int> list = {1, 5};
+  IndexedList<int> other = {2, 3, 4};
+  auto moved = other.Begin();
+  list.Splice(++list.Begin(), other);
+  EXPECT_TRUE(other.Empty());
+  EXPECT_EQ(Contents(list), (std::vector<int>{1, 2, 3, 4, 5}));
+  EXPECT_EQ(list.Index_of(moved), 1U);
+  ExpectIndexConsistent(list);
+
+  IndexedList<int> tail = {6, 7};
+  list.Splice(list.End(), tail);
+  IndexedList<int> head = {0};
+  list.Splice(list.Begin(), head);
+  EXPECT_EQ(Contents(list), (std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7}));
+  EXPECT_EQ(list.Back(), 7);
+  ExpectIndexConsistent(list);
+}
+
+TEST(IndexedListTest, Sort) {
+  IndexedList<int> list;
+  std::mt19937 rng(3);
+  std::vector<int> expected;
+  for (int i = 0; i < 300; ++i) {
+    int value = static_cast<int>(rng() % 50);
+    list.Push_back(value);
+    expected.push_back(value);
+  }
+  list.Sort();
+  std::sort(expected.begin(), expected.end());
+  EXPECT_EQ(Contents(list), expected);
+  EXPECT_EQ(list.Front(), expected.front());
+  EXPECT_EQ(list.Back(), expected.back());
+  ExpectIndexConsistent(list);
+  EXPECT_EQ(*list.Lower_bound(25), 25);
+}
+
+TEST(IndexedListTest, MatchesStdListUnderRandomEdits) {
+  IndexedList<int> list;
+  std::list<int> model;
+  std::mt19937 rng(11);
+  for (int step = 0; step < 2000; ++step) {
+    size_t k = model.empty() ? 0 : rng() % (model.size() + 1);
+    if (rng() % 3 || model.empty()) {
+      list.Insert(list.Advance(list.Begin(), static_cast<long>(k)), step);
+      model.insert(std::next(model.begin(), static_cast<long>(k)), step);
+    } else {
+      k %= model.size();
+      list.Erase(list.Advance(list.Begin(), static_cast<long>(k)));
+      model.erase(std::next(model.begin(), static_cast<long>(k)));
+    }
+  }
+  EXPECT_EQ(Contents(list), std::vector<int>(model.begin(), model.end()));
+  ExpectIndexConsistent(list);
+}
+
+}  // namespace
+}  // namespace s21
@@ -1,6 +1,9 @@
 #include <gtest/gtest.h>
 #include <queue>
+#include <ranges>
+#include <vector>
 #include "s21_queue.h"
+#include "s21_snapshot_queue.h"
 
 template class s21::Queue<int>;
 namespace s21 {
@@ -49,6 +52,24 @@ TEST(QueueTest, MoveAssignment) {
   EXPECT_EQ(moved.Back(), 13);
 }
 
+TEST(QueueTest, CopyAssignment) {
+  Queue<int> orig = {14, 15, 16};
+  Queue<int> copy = {1, 2, 3, 4};
+  copy = orig;
+  orig.Pop();
+
+  EXPECT_EQ(copy.Size(), 3);
+  EXPECT_EQ(copy.Front(), 14);
+  EXPECT_EQ(copy.Back(), 16);
+  EXPECT_EQ(orig.Front(), 15);
+
+  SnapshotQueue<int> snapshot_orig = {1, 2};
+  SnapshotQueue<int> snapshot_copy;
+  snapshot_copy = snapshot_orig;
+  snapshot_orig.Pop();
+  EXPECT_EQ(snapshot_copy.Front(), 1);
+}
+
 TEST(QueueTest, FrontBack) {
   Queue<int> q = {20, 30, 40};
   EXPECT_EQ(q.Front(), 20);
@@ -158,4 +179,70 @@ TEST(QueueTest, LargeData) {
 }
 
 }  // namespace
-}  // namespace s21
\ No newline at end of file
+}  // namespace s21
+namespace s21 {
+namespace {
+
+TEST(QueueTest, StatsDisabledHasNoOverhead) {
+  static_assert(sizeof(Queue<int>) == sizeof(List<int>));
+  Queue<int> q = {1, 2};
+  q.Pop();
+  QueueStats stats = q.Stats();
+  EXPECT_EQ(stats.container.pops, 0U);
+  EXPECT_EQ(stats.latency.Count(), 0U);
+}
+
+TEST(QueueTest, StatsRecordsLatency) {
+  Queue<int, CountingStats> q = {1, 2};
+  q.Push(3);
+  q.Insert_many_back(4, 5);
+  while (!q.Empty()) q.Pop();
+
+  QueueStats stats = q.Stats();
+  EXPECT_EQ(stats.container.pushes, 5U);
+  EXPECT_EQ(stats.container.pops, 5U);
+  EXPECT_EQ(stats.container.max_size, 5U);
+  EXPECT_EQ(stats.latency.Count(), 5U);
+  EXPECT_LE(stats.latency.Min(), stats.latency.Percentile(50));
+  EXPECT_LE(stats.latency.Percentile(50), stats.latency.Max());
+}
+
+TEST(QueueTest, LatencyHistogramBuckets) {
+  for (uint64_t value : {0ULL, 15ULL, 16ULL, 1000ULL, 123456789ULL}) {
+    size_t index = LatencyHistogram::Bucket_index(value);
+    uint64_t low = LatencyHistogram::Bucket_value(index);
+    EXPECT_LE(low, value);
+    EXPECT_LT(value - low, low / LatencyHistogram::kSubBuckets + 1);
+  }
+
+  LatencyHistogram histogram;
+  for (int i = 1; i <= 100; ++i) histogram.Record(std::chrono::nanoseconds(i));
+  EXPECT_EQ(histogram.Count(), 100U);
+  EXPECT_EQ(histogram.Min().count(), 1);
+  EXPECT_EQ(histogram.Max().count(), 100);
+  EXPECT_NEAR(histogram.Percentile(50).count(), 50, 4);
+  EXPECT_EQ(histogram.Percentile(100).count(), 100);
+}
+
+TEST(QueueTest, DrainIsConsumingInputRange) {
+  static_assert(std::ranges::input_range<Queue<int>::DrainView>);
+  static_assert(std::ranges::view<Queue<int>::DrainView>);
+
+  Queue<int> q = {1, 2, 3, 4, 5, 6, 7, 8};
+  std::vector<int> taken;
+  for (int v : q.Drain() | std::views::take(3)) taken.push_back(v);
+  EXPECT_EQ(taken, (std::vector<int>{1, 2, 3}));
+  EXPECT_EQ(q.Front(), 4);
+
+  std::vector<int> odd_tens;
+  for (int v : q.Drain() | std::views::filter([](int v) { return v % 2; }) |
+                   std::views::transform([](int v) { return v * 10; })) {
+    odd_tens.push_back(v);
+  }
+  EXPECT_EQ(odd_tens, (std::vector<int>{50, 70}));
+  EXPECT_TRUE(q.Empty());
+  EXPECT_TRUE(q.Drain().begin() == std::default_sentinel);
+}
+
+}  // namespace
+}  // namespace s21
@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../queue/s21_sharded_queue.h"
+
+template class s21::ShardedQueue<int>;
+namespace s21 {
+namespace {
+
+TEST(ShardedQueueTest, FifoWithinOneThread) {
+  ShardedQueue<std::string> queue(4);
+  EXPECT_EQ(queue.Shard_count(), 4U);
+  EXPECT_TRUE(queue.Empty());
+  queue.Push("a");
+  queue.Push("b");
+  EXPECT_EQ(queue.Size(), 2U);
+  EXPECT_EQ(queue.Size(SizeMode::kStrict), 2U);
+  EXPECT_EQ(queue.Try_pop().value_or(""), "a");
+  EXPECT_EQ(queue.Try_pop().value_or(""), "b");
+  EXPECT_FALSE(queue.Try_pop().has_value());
+  EXPECT_TRUE(queue.Empty(SizeMode::kStrict));
+}
+
+TEST(ShardedQueueTest, IdleThreadStealsOlderHalf) {
+  // Home shards are handed out round robin, so the threads below do not
+  // share one with the main thread.
+  ShardedQueue<int> queue(16);
+  for (int i = 0; i < 1000; ++i) queue.Push(i);
+
+  std::vector<int> popped;
+  std::thread first([&queue, &popped] {
+    popped.push_back(queue.Try_pop().value_or(-1));
+  });
+  first.join();
+  EXPECT_EQ(popped, (std::vector<int>{0}));
+  // The thief took 0 .. 255; the owner carries on with the rest.
+  EXPECT_EQ(queue.Try_pop().value_or(-1), 256);
+  EXPECT_EQ(queue.Size(SizeMode::kStrict), 998U);
+
+  std::thread rest([&queue, &popped] {
+    while (auto value = queue.Try_pop()) popped.push_back(*value);
+  });
+  rest.join();
+  ASSERT_EQ(popped.size(), 999U);
+  std::sort(popped.begin(), popped.end());
+  for (int i = 0; i < 999; ++i) EXPECT_EQ(popped[i], i < 256 ? i : i + 1);
+  EXPECT_TRUE(queue.Empty(SizeMode::kStrict));
+}
+
+TEST(ShardedQueueTest, StrictSizeSeesElementsBeingStolen) {
+  // Every element the consumers have not counted as started yet must be in
+  // some shard, including those in the middle of being stolen.
+  constexpr size_t kTotal = 20000;
+  ShardedQueue<int> queue(4);
+  for (size_t i = 0; i < kTotal; ++i) queue.Push(static_cast<int>(i));
+
+  std::atomic<size_t> started{0}, popped{0};
+  std::vector<std::thread> consumers;
+  for (int c = 0; c < 3; ++c) {
+    consumers.emplace_back([&] {
+      while (popped.load() < kTotal) {
+        started.fetch_add(1);
+        if (queue.Try_pop()) popped.fetch_add(1);
+      }
+    });
+  }
+  while (popped.load() < kTotal) {
+    const size_t size = queue.Size(SizeMode::kStrict);
+    ASSERT_GE(size + started.load(), kTotal);
+  }
+  for (auto &consumer : consumers) consumer.join();
+  EXPECT_TRUE(queue.Empty(SizeMode::kStrict));
+}
+
+TEST(ShardedQueueTest, ConcurrentProducersAndConsumers) {
+  constexpr int kThreads = 4;
+  constexpr int kPerThread = 20000;
+  ShardedQueue<int> queue(kThreads);
+  std::atomic<long> sum{0};
+  std::atomic<int> popped{0};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&] {
+      for (int i = 1; i <= kPerThread; ++i) queue.Push(i);
+    });
+    threads.emplace_back([&] {
+      while (popped.load() < kThreads * kPerThread) {
+        if (auto value = queue.Try_pop()) {
+          sum += *value;
+          ++popped;
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+  EXPECT_EQ(sum.load(), static_cast<long>(kThreads) * kPerThread *
+                            (kPerThread + 1) / 2);
+  EXPECT_EQ(queue.Size(SizeMode::kStrict), 0U);
+  EXPECT_EQ(queue.Size(), 0U);
+}
+
+}  // namespace
+}  // namespace s21
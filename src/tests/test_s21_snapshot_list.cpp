@@ -0,0 +1,180 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../list/s21_snapshot_list.h"
+#include "../queue/s21_snapshot_queue.h"
+
+template class s21::SnapshotList<int>;
+template class s21::Queue<int, s21::NoStats, s21::SnapshotList<int>>;
+namespace s21 {
+namespace {
+
+template <typename Range>
+std::vector<int> Contents(const Range &range) {
+  return std::vector<int>(range.begin(), range.end());
+}
+
+TEST(SnapshotListTest, FifoOperations) {
+  SnapshotList<int> list = {1, 2};
+  list.Push_back(3);
+  list.Insert_many_back(4, 5);
+  EXPECT_EQ(list.Size(), 5U);
+  EXPECT_EQ(list.Front(), 1);
+  EXPECT_EQ(list.Back(), 5);
+  list.Pop_front();
+  EXPECT_EQ(Contents(list), (std::vector<int>{2, 3, 4, 5}));
+  list.Clear();
+  EXPECT_TRUE(list.Empty());
+  EXPECT_EQ(list.Begin(), list.End());
+  EXPECT_THROW(list.Front(), std::out_of_range);
+  EXPECT_THROW(list.Back(), std::out_of_range);
+  EXPECT_THROW(list.Pop_front(), std::out_of_range);
+}
+
+TEST(SnapshotListTest, SpansManySegments) {
+  SnapshotList<int> list;
+  std::vector<int> expected;
+  for (int i = 0; i < 5000; ++i) {
+    list.Push_back(i);
+    expected.push_back(i);
+    if (i % 3 == 0) {
+      list.Pop_front();
+      expected.erase(expected.begin());
+    }
+  }
+  EXPECT_EQ(Contents(list), expected);
+  EXPECT_EQ(list.Front(), expected.front());
+  while (!list.Empty()) list.Pop_front();
+  list.Push_back(42);
+  EXPECT_EQ(Contents(list), (std::vector<int>{42}));
+}
+
+TEST(SnapshotListTest, CopyMoveAndSwap) {
+  SnapshotList<int> a = {1, 2, 3};
+  SnapshotList<int> b(a);
+  b.Push_back(4);
+  EXPECT_EQ(Contents(a), (std::vector<int>{1, 2, 3}));
+  EXPECT_EQ(Contents(b), (std::vector<int>{1, 2, 3, 4}));
+  SnapshotList<int> c(std::move(a));
+  EXPECT_TRUE(a.Empty());
+  c.Swap(b);
+  EXPECT_EQ(c.Size(), 4U);
+  b = std::move(c);
+  EXPECT_EQ(Contents(b), (std::vector<int>{1, 2, 3, 4}));
+}
+
+TEST(SnapshotListTest, SnapshotIsFrozen) {
+  SnapshotList<int> list;
+  for (int i = 0; i < 1000; ++i) list.Push_back(i);
+  auto snapshot = list.Snapshot();
+  for (int i = 0; i < 700; ++i) list.Pop_front();
+  for (int i = 1000; i < 3000; ++i) list.Push_back(i);
+
+  std::vector<int> expected(1000);
+  std::iota(expected.begin(), expected.end(), 0);
+  EXPECT_EQ(snapshot.Size(), 1000U);
+  EXPECT_EQ(snapshot.Front(), 0);
+  EXPECT_EQ(snapshot.Back(), 999);
+  EXPECT_EQ(Contents(snapshot), expected);
+
+  list.Clear();
+  EXPECT_EQ(Contents(snapshot), expected);
+  auto copy = snapshot;
+  snapshot = list.Snapshot();
+  EXPECT_TRUE(snapshot.Empty());
+  EXPECT_EQ(Contents(copy), expected);
+}
+
+TEST(SnapshotListTest, PoppedElementsLiveAsLongAsASnapshot) {
+  SnapshotList<std::shared_ptr<int>> list;
+  std::weak_ptr<int> watched;
+  {
+    auto value = std::make_shared<int>(7);
+    watched = value;
+    list.Push_back(std::move(value));
+  }
+  auto snapshot = list.Snapshot();
+  list.Pop_front();
+  list.Clear();
+  ASSERT_FALSE(watched.expired());
+  EXPECT_EQ(*snapshot.Front(), 7);
+  snapshot = SnapshotListView<std::shared_ptr<int>>();
+  EXPECT_TRUE(watched.expired());
+}
+
+TEST(SnapshotListTest, NonTrivialElements) {
+  SnapshotList<std::string> list;
+  for (int i = 0; i < 300; ++i) list.Emplace_back(40, 'a' + i % 26);
+  auto snapshot = list.Snapshot();
+  for (int i = 0; i < 150; ++i) list.Pop_front();
+  EXPECT_EQ(snapshot.Size(), 300U);
+  EXPECT_EQ(snapshot.Back(), std::string(40, 'a' + 299 % 26));
+  EXPECT_EQ(list.Front(), std::string(40, 'a' + 150 % 26));
+}
+
+TEST(SnapshotListTest, ReadSnapshotWhileSourceMutates) {
+  SnapshotList<int> list;
+  for (int i = 0; i < 10000; ++i) list.Push_back(i);
+  auto snapshot = list.Snapshot();
+  long sum = 0;
+  std::thread reader([&snapshot, &sum] {
+    for (int round = 0; round < 20; ++round) {
+      sum = 0;
+      for (int value : snapshot) sum += value;
+    }
+  });
+  for (int i = 0; i < 50000; ++i) {
+    list.Push_back(i);
+    list.Pop_front();
+  }
+  reader.join();
+  EXPECT_EQ(sum, 10000L * 9999 / 2);
+}
+
+TEST(SnapshotListTest, Stats) {
+  SnapshotList<int, CountingStats> list;
+  for (int i = 0; i < 3; ++i) list.Push_back(i);
+  list.Pop_front();
+  ContainerStats stats = list.Stats();
+  EXPECT_EQ(stats.pushes, 3U);
+  EXPECT_EQ(stats.pops, 1U);
+  EXPECT_EQ(stats.max_size, 3U);
+  EXPECT_EQ(stats.allocations, 1U);
+  list.Clear();
+  EXPECT_EQ(list.Stats().frees, 1U);
+}
+
+TEST(SnapshotQueueTest, QueueOperationsAndSnapshot) {
+  SnapshotQueue<int> queue = {1, 2, 3};
+  queue.Push(4);
+  queue.Pop();
+  auto snapshot = queue.Snapshot();
+  queue.Pop();
+  queue.Insert_many_back(5, 6);
+  EXPECT_EQ(Contents(snapshot), (std::vector<int>{2, 3, 4}));
+  EXPECT_EQ(queue.Front(), 3);
+  EXPECT_EQ(queue.Back(), 6);
+  EXPECT_EQ(queue.Size(), 4U);
+
+  SnapshotQueue<int> copy(queue);
+  copy.Pop();
+  EXPECT_EQ(queue.Front(), 3);
+  EXPECT_EQ(copy.Front(), 4);
+}
+
+TEST(SnapshotQueueTest, LatencyStats) {
+  SnapshotQueue<int, CountingStats> queue;
+  queue.Push(1);
+  queue.Pop();
+  QueueStats stats = queue.Stats();
+  EXPECT_EQ(stats.container.pushes, 1U);
+  EXPECT_EQ(stats.latency.Count(), 1U);
+}
+
+}  // namespace
+}  // namespace s21
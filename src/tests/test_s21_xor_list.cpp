@@ -0,0 +1,198 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <random>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../list/s21_xor_list.h"
+
+template class s21::XorList<int>;
+namespace s21 {
+namespace {
+
+template <typename T>
+std::vector<T> Forward(const XorList<T> &list) {
+  return std::vector<T>(list.begin(), list.end());
+}
+
+template <typename T>
+std::vector<T> Backward(const XorList<T> &list) {
+  std::vector<T> values;
+  for (const T &value : list | std::views::reverse) values.push_back(value);
+  return values;
+}
+
+TEST(XorListTest, PushPopBothEnds) {
+  static_assert(std::ranges::bidirectional_range<XorList<int>>);
+  XorList<int> list;
+  EXPECT_TRUE(list.Empty());
+  EXPECT_THROW(list.Front(), std::out_of_range);
+  EXPECT_THROW(list.Pop_back(), std::out_of_range);
+  list.Push_back(2);
+  list.Push_back(3);
+  list.Push_front(1);
+  EXPECT_EQ(list.Size(), 3U);
+  EXPECT_EQ(list.Front(), 1);
+  EXPECT_EQ(list.Back(), 3);
+  EXPECT_EQ(Forward(list), (std::vector<int>{1, 2, 3}));
+  EXPECT_EQ(Backward(list), (std::vector<int>{3, 2, 1}));
+  list.Pop_back();
+  list.Pop_front();
+  EXPECT_EQ(Forward(list), (std::vector<int>{2}));
+  list.Pop_front();
+  EXPECT_TRUE(list.Empty());
+  EXPECT_EQ(list.begin(), list.end());
+}
+
+TEST(XorListTest, InsertEraseAndIterators) {
+  XorList<int> list = {1, 2, 4, 5};
+  auto it = list.Begin();
+  ++it;
+  ++it;
+  it = list.Insert(it, 3);
+  EXPECT_EQ(*it, 3);
+  EXPECT_EQ(*--it, 2);
+  it = list.Erase(it);
+  EXPECT_EQ(*it, 3);
+  EXPECT_EQ(Forward(list), (std::vector<int>{1, 3, 4, 5}));
+  auto last = list.End();
+  EXPECT_EQ(*--last, 5);
+  EXPECT_EQ(list.Erase(last), list.End());
+  EXPECT_THROW(list.Erase(list.End()), std::out_of_range);
+  EXPECT_EQ(Backward(list), (std::vector<int>{4, 3, 1}));
+  XorList<int>::const_iterator c = list.Begin();
+  EXPECT_EQ(*c, 1);
+}
+
+TEST(XorListTest, ReverseIsConstantTime) {
+  XorList<int> list = {1, 2, 3, 4};
+  list.Reverse();
+  EXPECT_EQ(Forward(list), (std::vector<int>{4, 3, 2, 1}));
+  list.Push_back(0);
+  list.Push_front(5);
+  EXPECT_EQ(Forward(list), (std::vector<int>{5, 4, 3, 2, 1, 0}));
+  list.Reverse();
+  EXPECT_EQ(Backward(list), (std::vector<int>{5, 4, 3, 2, 1, 0}));
+}
+
+TEST(XorListTest, SpliceAnywhere) {
+  XorList<int> list = {1, 5};
+  XorList<int> middle = {2, 3, 4};
+  auto pos = list.Begin();
+  list.Splice(++pos, middle);
+  EXPECT_TRUE(middle.Empty());
+  EXPECT_EQ(Forward(list), (std::vector<int>{1, 2, 3, 4, 5}));
+
+  XorList<int> front = {0};
+  list.Splice(list.Begin(), front);
+  XorList<int> back = {6, 7};
+  list.Splice(list.End(), back);
+  XorList<int> empty;
+  list.Splice(list.Begin(), empty);
+  EXPECT_EQ(Forward(list), (std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7}));
+  EXPECT_EQ(Backward(list), (std::vector<int>{7, 6, 5, 4, 3, 2, 1, 0}));
+
+  // Spliced nodes outlive the list they were allocated by.
+  {
+    XorList<int> source = {8, 9};
+    empty.Splice(empty.End(), source);
+  }
+  empty.Pop_front();
+  empty.Push_back(10);
+  EXPECT_EQ(Forward(empty), (std::vector<int>{9, 10}));
+}
+
+TEST(XorListTest, CopyMoveAndNonTrivialValues) {
+  auto tracked = std::make_shared<int>(0);
+  {
+    XorList<std::shared_ptr<int>> list;
+    for (int i = 0; i < 100; ++i) list.Push_back(tracked);
+    XorList<std::shared_ptr<int>> copy(list);
+    XorList<std::shared_ptr<int>> moved(std::move(list));
+    EXPECT_TRUE(list.Empty());
+    EXPECT_EQ(tracked.use_count(), 201);
+    copy = moved;
+    moved.Clear();
+    EXPECT_EQ(tracked.use_count(), 101);
+  }
+  EXPECT_EQ(tracked.use_count(), 1);
+
+  XorList<std::string> words = {"a", "b"};
+  words = XorList<std::string>{"c"};
+  EXPECT_EQ(Forward(words), (std::vector<std::string>{"c"}));
+}
+
+TEST(XorListTest, ThrowingCopyReturnsTheSlot) {
+  struct Fragile {
+    Fragile(int v = 0) : value(v) {}
+    Fragile(const Fragile &other) : value(other.value) {
+      if (value < 0) throw std::runtime_error("copy failed");
+    }
+    int value;
+  };
+  const size_t blocks_before = detail::Arena_blocks();
+  {
+    XorList<Fragile> list;
+    list.Reserve(32);
+    list.Push_back(Fragile(1));
+    EXPECT_THROW(list.Push_back(Fragile(-1)), std::runtime_error);
+    EXPECT_THROW(list.Push_front(Fragile(-1)), std::runtime_error);
+    EXPECT_EQ(list.Size(), 1U);
+    EXPECT_EQ(list.Front().value, 1);
+  }
+  EXPECT_EQ(detail::Arena_blocks(), blocks_before);
+}
+
+TEST(XorListTest, MatchesStdList) {
+  std::mt19937 rng(3);
+  XorList<uint32_t> list;
+  std::list<uint32_t> model;
+  for (int step = 0; step < 20000; ++step) {
+    uint32_t value = rng();
+    switch (rng() % 6) {
+      case 0:
+        list.Push_back(value);
+        model.push_back(value);
+        break;
+      case 1:
+        list.Push_front(value);
+        model.push_front(value);
+        break;
+      case 2:
+        if (!model.empty()) {
+          list.Pop_back();
+          model.pop_back();
+        }
+        break;
+      case 3:
+        if (!model.empty()) {
+          list.Pop_front();
+          model.pop_front();
+        }
+        break;
+      case 4:
+        list.Reverse();
+        model.reverse();
+        break;
+      default: {
+        size_t at = model.empty() ? 0 : rng() % model.size();
+        auto it = list.Begin();
+        auto mit = model.begin();
+        for (size_t i = 0; i < at; ++i, ++it, ++mit) {
+        }
+        list.Insert(it, value);
+        model.insert(mit, value);
+      }
+    }
+  }
+  ASSERT_EQ(list.Size(), model.size());
+  EXPECT_TRUE(std::ranges::equal(list, model));
+}
+
+}  // namespace
+}  // namespace s21
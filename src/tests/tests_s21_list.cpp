@@ -1,10 +1,23 @@
 #include <gtest/gtest.h>
 #include <list>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <ranges>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
 #include "../list/s21_list.h"
 
 template class s21::List<int>;
+template class s21::List<int, s21::NoStats, s21::ArenaNodes>;
 
-bool compare_lists(s21::List<int> my_list, std::list<int> std_list) {
+template <typename L>
+bool compare_lists(L my_list, std::list<int> std_list) {
   bool result = true;
   if (my_list.Size() == std_list.size()) {
     auto my_it = my_list.Begin();
@@ -92,6 +105,71 @@ TEST(ListTest, MoveConstructor) {
   ASSERT_TRUE(s21_empty_move.Empty());
 }
 
+TEST(ListTest, CopyAssignmentOperator) {
+  s21::List<int> s21_src = {1, 2, 3};
+  s21::List<int> s21_longer = {4, 5, 6, 7, 8};
+  s21::List<int> s21_shorter = {9};
+  s21_longer = s21_src;
+  s21_shorter = s21_src;
+  std::list<int> std_src = {1, 2, 3};
+  ASSERT_TRUE(compare_lists(s21_longer, std_src));
+  ASSERT_TRUE(compare_lists(s21_shorter, std_src));
+  ASSERT_TRUE(compare_lists(s21_src, std_src));
+  ASSERT_EQ(s21_longer.Back(), 3);
+  ASSERT_EQ(s21_shorter.Back(), 3);
+
+  s21::List<int> &alias = s21_src;
+  s21_src = alias;
+  ASSERT_TRUE(compare_lists(s21_src, std_src));
+
+  s21::List<int> s21_empty;
+  s21_longer = s21_empty;
+  ASSERT_TRUE(s21_longer.Empty());
+  s21_longer.Push_back(1);
+  ASSERT_EQ(s21_longer.Front(), 1);
+}
+
+TEST(ListTest, AssignOverloads) {
+  s21::List<int> list = {1, 2, 3};
+  list.Assign(5, 7);
+  ASSERT_TRUE(compare_lists(list, std::list<int>(5, 7)));
+  list.Assign({4, 5});
+  ASSERT_TRUE(compare_lists(list, std::list<int>{4, 5}));
+  std::vector<int> values(40);
+  for (size_t i = 0; i < values.size(); ++i) values[i] = static_cast<int>(i);
+  list.Assign(values.begin(), values.end());
+  ASSERT_TRUE(
+      compare_lists(list, std::list<int>(values.begin(), values.end())));
+  list.Pop_front();
+  list.Push_front(-1);
+  ASSERT_EQ(list.Front(), -1);
+  list.Assign(values.begin(), values.begin());
+  ASSERT_TRUE(list.Empty());
+}
+
+TEST(ListTest, AssignReusesNodes) {
+  s21::List<int, s21::CountingStats> list = {1, 2, 3, 4, 5};
+  s21::List<int, s21::CountingStats> other = {6, 7, 8};
+  list = other;
+  ASSERT_EQ(list.Stats().allocations, 5U);
+  ASSERT_EQ(list.Stats().frees, 2U);
+  list.Assign({1, 2, 3, 4});
+  ASSERT_EQ(list.Stats().allocations, 6U);
+  ASSERT_EQ(list.Stats().frees, 2U);
+  list.Assign(4, 0);
+  ASSERT_EQ(list.Stats().allocations, 6U);
+}
+
+TEST(ListTest, AssignNonTrivial) {
+  s21::List<std::string> list = {"a", "b"};
+  s21::List<std::string> other = {"long enough to live on the heap", "c", "d"};
+  list = other;
+  other.Clear();
+  ASSERT_EQ(list.Front(), "long enough to live on the heap");
+  ASSERT_EQ(list.Back(), "d");
+  ASSERT_EQ(list.Size(), 3U);
+}
+
 TEST(ListTest, MoveAssignmentOperator) {
   s21::List<int> s21_src = {1, 2, 3};
   s21::List<int> s21_dest = {4, 5};
@@ -421,6 +499,16 @@ TEST(ListTest, PushBack) {
   std_list.push_back(6);
   EXPECT_TRUE(compare_lists(my_list, std_list));
 }
+TEST(ListTest, PushBack_MovesRvalues) {
+  s21::List<std::unique_ptr<int>> list;
+  auto value = std::make_unique<int>(1);
+  list.Push_back(std::move(value));
+  list.Push_back(std::make_unique<int>(2));
+  EXPECT_EQ(value, nullptr);
+  EXPECT_EQ(*list.Front(), 1);
+  EXPECT_EQ(*list.Back(), 2);
+}
+
 TEST(ListTest, PushFront) {
   s21::List<int> my_list{1, 2, 3, 4, 5};
   my_list.Push_front(0);
@@ -593,6 +681,40 @@ TEST(ListTest, Splice_InsertInMiddle) {
   EXPECT_EQ(*iter++, 2);
   EXPECT_EQ(*iter++, 30);
 }
+
+TEST(ListTest, Splice_SingleNode) {
+  s21::List<int> list1 = {10, 30};
+  s21::List<int> list2 = {1, 2, 3};
+
+  auto moved = ++list2.Begin();
+  list1.Splice(++list1.Begin(), list2, moved);
+  EXPECT_TRUE(compare_lists(list1, {10, 2, 30}));
+  EXPECT_TRUE(compare_lists(list2, {1, 3}));
+  EXPECT_EQ(*moved, 2);
+
+  list1.Splice(list1.End(), list2, list2.Begin());
+  list1.Splice(list1.Begin(), list2, list2.Begin());
+  EXPECT_TRUE(compare_lists(list1, {3, 10, 2, 30, 1}));
+  EXPECT_TRUE(list2.Empty());
+  EXPECT_EQ(list1.Back(), 1);
+
+  // Within one list, including the no-op cases.
+  list1.Splice(list1.End(), list1, list1.Begin());
+  EXPECT_TRUE(compare_lists(list1, {10, 2, 30, 1, 3}));
+  auto after_moved = moved;
+  ++after_moved;
+  list1.Splice(moved, list1, moved);
+  list1.Splice(after_moved, list1, moved);
+  EXPECT_TRUE(compare_lists(list1, {10, 2, 30, 1, 3}));
+  auto last = after_moved;
+  ++last;
+  ++last;
+  list1.Splice(list1.Begin(), list1, last);
+  EXPECT_TRUE(compare_lists(list1, {3, 10, 2, 30, 1}));
+  EXPECT_EQ(list1.Back(), 1);
+  EXPECT_THROW(list1.Splice(list1.Begin(), list2, list2.End()),
+               std::out_of_range);
+}
 TEST(ListTest, PushFront_EmptyList) {
   s21::List<int> list;
   list.Push_front(42);
@@ -672,3 +794,586 @@ TEST(ListTest, Erase_Middle_Alternative) {
   EXPECT_EQ(*iter++, 30);
   EXPECT_EQ(*iter++, 50);
 }
+
+TEST(ListTest, Stats_DisabledByDefault) {
+  // head_, tail_ and size_; NoStats and HeapNodes add nothing.
+  static_assert(sizeof(s21::List<int>) == 2 * sizeof(void *) + sizeof(size_t));
+  static_assert(sizeof(s21::ArenaList<int>) ==
+                4 * sizeof(void *) + sizeof(size_t));
+  // Plain nodes are the value and two links, with no arena tag.
+  EXPECT_EQ(s21::List<uint64_t>().Max_size(),
+            std::numeric_limits<size_t>::max() /
+                (sizeof(uint64_t) + 2 * sizeof(void *)));
+  static_assert(sizeof(s21::List<int>) + sizeof(s21::CountingStats) ==
+                sizeof(s21::List<int, s21::CountingStats>));
+  s21::List<int> list = {1, 2, 3};
+  list.Pop_front();
+  s21::ContainerStats stats = list.Stats();
+  EXPECT_EQ(stats.allocations, 0U);
+  EXPECT_EQ(stats.pushes, 0U);
+  EXPECT_EQ(stats.pops, 0U);
+}
+
+TEST(ListTest, Stats_CountsHotPaths) {
+  s21::List<int, s21::CountingStats> list = {3, 1, 2};
+  list.Push_front(0);
+  list.Insert(++list.Begin(), 7);
+  list.Pop_back();
+  list.Erase(++list.Begin());
+
+  s21::List<int, s21::CountingStats> other = {5, 6};
+  list.Splice(list.End(), other);
+  s21::List<int, s21::CountingStats> sorted = {4};
+  list.Sort();
+  list.Merge(sorted);
+
+  // Sort rebuilds the list through Push_back, five more pushes.
+  s21::ContainerStats stats = list.Stats();
+  EXPECT_EQ(stats.pushes, 10U);
+  EXPECT_EQ(stats.pops, 2U);
+  EXPECT_EQ(stats.max_size, 6U);
+  EXPECT_EQ(stats.splice_calls, 1U);
+  EXPECT_EQ(stats.merge_calls, 1U);
+  EXPECT_EQ(stats.sort_calls, 1U);
+  EXPECT_GE(stats.allocations, 5U);
+  EXPECT_GE(stats.frees, 2U);
+}
+
+template <typename L>
+static bool is_contiguous(const L &list) {
+  bool result = true;
+  std::ptrdiff_t stride = 0;
+  const int *previous = nullptr;
+  for (auto it = list.Cbegin(); it != list.Cend() && result; ++it) {
+    const char *current = reinterpret_cast<const char *>(&*it);
+    if (previous) {
+      std::ptrdiff_t delta =
+          current - reinterpret_cast<const char *>(previous);
+      if (stride == 0) stride = delta;
+      result = delta > 0 && delta == stride;
+    }
+    previous = &*it;
+  }
+  return result;
+}
+
+TEST(ListTest, Reserve_PushBackIsContiguous) {
+  s21::ArenaList<int> list;
+  list.Reserve(100);
+  for (int i = 0; i < 100; ++i) list.Push_back(i);
+  EXPECT_TRUE(is_contiguous(list));
+  EXPECT_EQ(list.Size(), 100U);
+  EXPECT_EQ(list.Back(), 99);
+}
+
+TEST(ListTest, Compact_FragmentedList) {
+  s21::ArenaList<int> parts[4];
+  for (int i = 0; i < 400; ++i) parts[i % 4].Push_back(i);
+  s21::ArenaList<int> list;
+  for (auto &part : parts) list.Splice(list.End(), part);
+  list.Erase(list.Begin());
+  list.Push_front(-1);
+
+  std::list<int> expected;
+  for (auto it = list.Cbegin(); it != list.Cend(); ++it) {
+    expected.push_back(*it);
+  }
+  list.Compact();
+  EXPECT_TRUE(is_contiguous(list));
+  EXPECT_TRUE(compare_lists(list, expected));
+  EXPECT_EQ(list.Front(), -1);
+  EXPECT_EQ(list.Back(), 399);
+}
+
+TEST(ListTest, Compact_NodesOutliveTheirList) {
+  s21::ArenaList<int> target = {100};
+  {
+    s21::ArenaList<int> source = {3, 1, 2};
+    source.Compact();
+    source.Erase(++source.Begin());
+    source.Push_back(4);
+    target.Splice(target.Begin(), source);
+    s21::ArenaList<int> merged = {0, 5};
+    merged.Compact();
+    target.Merge(merged);
+  }
+  target.Pop_front();
+  target.Push_back(7);
+  EXPECT_TRUE(compare_lists(target, {3, 2, 4, 5, 100, 7}));
+  target.Clear();
+  target.Push_back(8);
+  EXPECT_EQ(target.Front(), 8);
+}
+
+TEST(ListTest, Compact_EmptyAndMoved) {
+  s21::ArenaList<int> empty;
+  empty.Compact();
+  EXPECT_TRUE(empty.Empty());
+
+  s21::ArenaList<int> list = {1, 2, 3};
+  list.Compact();
+  s21::ArenaList<int> moved(std::move(list));
+  moved.Sort();
+  list = std::move(moved);
+  EXPECT_TRUE(compare_lists(list, {1, 2, 3}));
+}
+
+TEST(ListTest, Compact_CopyOnlyType) {
+  struct CopyOnly {
+    CopyOnly(int v = 0) : value(v) {}
+    CopyOnly(const CopyOnly &other) : value(other.value) {}
+    CopyOnly &operator=(const CopyOnly &other) = default;
+    bool operator<(const CopyOnly &other) const { return value < other.value; }
+    bool operator==(const CopyOnly &other) const {
+      return value == other.value;
+    }
+    int value;
+  };
+  s21::ArenaList<CopyOnly> list = {CopyOnly(1), CopyOnly(2), CopyOnly(3)};
+  list.Erase(++list.Begin());
+  list.Compact();
+  EXPECT_EQ(list.Size(), 2U);
+  EXPECT_EQ(list.Front().value, 1);
+  EXPECT_EQ(list.Back().value, 3);
+}
+
+TEST(ListTest, Arena_SpliceAndPopStaySteady) {
+  // Batches built with Assign, spliced into a long-lived list and popped
+  // there: every block must go back once its nodes are gone, and later
+  // rounds must cost no more than early ones.
+  const size_t blocks_before = s21::detail::Arena_blocks();
+  size_t blocks_max = blocks_before;
+  s21::ArenaList<int> batch;
+  s21::ArenaList<int> queue;
+  auto rounds = [&](int count) {
+    const auto start = std::chrono::steady_clock::now();
+    for (int round = 0; round < count; ++round) {
+      batch.Assign(64, round);
+      queue.Splice(queue.End(), batch);
+      blocks_max = std::max(blocks_max, s21::detail::Arena_blocks());
+      for (int i = 0; i < 64; ++i) queue.Pop_front();
+    }
+    return std::chrono::steady_clock::now() - start;
+  };
+  const auto first = rounds(1000);
+  rounds(2000);
+  const auto last = rounds(1000);
+  EXPECT_TRUE(queue.Empty());
+  EXPECT_EQ(s21::detail::Arena_blocks(), blocks_before);
+  EXPECT_LE(blocks_max, blocks_before + 1);
+  EXPECT_LT(last, 3 * first + std::chrono::milliseconds(20));
+}
+
+TEST(ListTest, Arena_ForeignNodesGoBackToTheirBlock) {
+  const size_t blocks_before = s21::detail::Arena_blocks();
+  s21::ArenaList<int> owner;
+  owner.Reserve(100);
+  for (int i = 0; i < 100; ++i) owner.Push_back(i);
+  owner.Reserve(100);  // a second block, still empty
+  s21::ArenaList<int> other = {-1};
+  other.Reserve(10);
+  other.Splice(other.End(), owner);
+  EXPECT_EQ(s21::detail::Arena_blocks(), blocks_before + 3);
+  s21::ArenaList<int> tail = other.Split(++other.Begin(), 100);
+  other.Clear();
+  while (!tail.Empty()) tail.Pop_back();
+  EXPECT_EQ(s21::detail::Arena_blocks(), blocks_before + 2);
+  for (int i = 0; i < 100; ++i) owner.Push_back(i);
+  EXPECT_TRUE(is_contiguous(owner));
+  owner.Clear();
+  owner.Push_back(1);  // reuses a cached slot
+  EXPECT_EQ(s21::detail::Arena_blocks(), blocks_before + 2);
+}
+
+TEST(ListTest, Arena_LargeReserveIsChained) {
+  // Blocks stop at kArenaMaxBlockBytes, so this takes several, each filled
+  // in address order: the pushes run contiguously except at block seams.
+  const int count = static_cast<int>(s21::detail::kArenaMaxBlockBytes / 8);
+  const size_t blocks_before = s21::detail::Arena_blocks();
+  {
+    s21::ArenaList<int> list;
+    list.Reserve(count);
+    const size_t blocks = s21::detail::Arena_blocks() - blocks_before;
+    EXPECT_GE(blocks, 3U);
+    for (int i = 0; i < count; ++i) list.Push_back(i);
+    EXPECT_EQ(s21::detail::Arena_blocks() - blocks_before, blocks);
+    auto address = [](const int &value) {
+      return reinterpret_cast<std::uintptr_t>(&value);
+    };
+    const std::uintptr_t stride =
+        address(*++list.Cbegin()) - address(list.Front());
+    size_t seams = 0;
+    for (auto it = ++list.Cbegin(); it != list.Cend(); ++it) {
+      seams += address(*it) != address(*std::prev(it)) + stride;
+    }
+    EXPECT_EQ(seams, blocks - 1);
+    EXPECT_EQ(list.Max(), count - 1);
+    EXPECT_EQ(list.Count(count / 2), 1U);
+    list.Compact();
+    EXPECT_EQ(s21::detail::Arena_blocks() - blocks_before, blocks);
+  }
+  EXPECT_EQ(s21::detail::Arena_blocks(), blocks_before);
+}
+
+TEST(ListTest, Arena_ThrowingCopyReturnsTheSlot) {
+  struct Fragile {
+    Fragile(int v = 0) : value(v) {}
+    Fragile(const Fragile &other) : value(other.value) {
+      if (value < 0) throw std::runtime_error("copy failed");
+    }
+    Fragile &operator=(const Fragile &other) = default;
+    int value;
+  };
+  const size_t blocks_before = s21::detail::Arena_blocks();
+  {
+    s21::ArenaList<Fragile> list;
+    list.Reserve(32);
+    list.Push_back(Fragile(1));
+    EXPECT_THROW(list.Push_back(Fragile(-1)), std::runtime_error);
+    list.Push_back(Fragile(2));
+    list.Begin()->value = -1;  // Compact copies this one first
+    EXPECT_THROW(list.Compact(), std::runtime_error);
+    EXPECT_EQ(list.Size(), 2U);
+  }
+  EXPECT_EQ(s21::detail::Arena_blocks(), blocks_before);
+}
+
+TEST(ListTest, BulkQueries_MatchNodeWalk) {
+  s21::ArenaList<int> list;
+  list.Reserve(1000);
+  for (int i = 0; i < 1000; ++i) list.Push_back((i * 37) % 101 - 50);
+  list.Insert(list.Begin(), 7);  // outside the reserved run
+  for (int pass = 0; pass < 2; ++pass) {
+    int sum = 0, min = 7, max = 7;
+    size_t sevens = 0;
+    for (auto it = list.Cbegin(); it != list.Cend(); ++it) {
+      sum += *it;
+      min = std::min(min, *it);
+      max = std::max(max, *it);
+      sevens += *it == 7;
+    }
+    EXPECT_EQ(list.Sum(), sum);
+    EXPECT_EQ(list.Min(), min);
+    EXPECT_EQ(list.Max(), max);
+    EXPECT_EQ(list.Count(7), sevens);
+    EXPECT_TRUE(list.Contains(-50));
+    EXPECT_FALSE(list.Contains(51));
+    list.Compact();
+  }
+
+  auto it = list.Find(50);
+  ASSERT_NE(it, list.End());
+  EXPECT_EQ(*it, 50);
+  int before = 0;
+  for (auto walk = list.Begin(); walk != it; ++walk) before += *walk == 50;
+  EXPECT_EQ(before, 0);
+  EXPECT_EQ(list.Find(1000), list.End());
+}
+
+TEST(ListTest, BulkQueries_DoubleAndGeneric) {
+  s21::ArenaList<double> doubles;
+  doubles.Reserve(64);
+  for (int i = 0; i < 64; ++i) doubles.Push_back(i * 0.5);
+  EXPECT_DOUBLE_EQ(doubles.Sum(), 1008.0);
+  EXPECT_DOUBLE_EQ(doubles.Min(), 0.0);
+  EXPECT_DOUBLE_EQ(doubles.Max(), 31.5);
+  EXPECT_EQ(doubles.Count(2.5), 1U);
+  const s21::ArenaList<double> &view = doubles;
+  EXPECT_DOUBLE_EQ(*view.Find(31.0), 31.0);
+
+  s21::List<std::string> words = {"b", "a", "c"};
+  EXPECT_EQ(words.Sum(), "bac");
+  EXPECT_EQ(words.Min(), "a");
+  EXPECT_EQ(words.Max(), "c");
+  EXPECT_TRUE(words.Contains("c"));
+
+  s21::List<int> empty;
+  EXPECT_EQ(empty.Sum(), 0);
+  EXPECT_EQ(empty.Count(1), 0U);
+  EXPECT_EQ(empty.Find(1), empty.End());
+  EXPECT_THROW(empty.Min(), std::out_of_range);
+  EXPECT_THROW(empty.Max(), std::out_of_range);
+}
+
+TEST(ListTest, ClearIncremental) {
+  s21::List<int> list;
+  for (int i = 0; i < 10; ++i) list.Push_back(i);
+  EXPECT_EQ(list.Clear_incremental(4), 6U);
+  EXPECT_EQ(list.Front(), 4);
+  EXPECT_EQ(list.Back(), 9);
+  list.Push_front(-1);
+  EXPECT_EQ(list.Clear_incremental(0), 7U);
+  EXPECT_EQ(list.Clear_incremental(100), 0U);
+  EXPECT_TRUE(list.Empty());
+  list.Push_back(1);
+  EXPECT_EQ(list.Front(), 1);
+  EXPECT_EQ(list.Back(), 1);
+}
+
+TEST(ListTest, Reclaimer_ClearDetachesChain) {
+  s21::NodeReclaimer reclaimer(16);
+  auto tracked = std::make_shared<int>(0);
+  s21::ArenaList<std::shared_ptr<int>, s21::CountingStats> list;
+  list.Set_reclaimer(&reclaimer);
+  list.Reserve(100);
+  for (int i = 0; i < 300; ++i) list.Push_back(tracked);
+  list.Clear();
+  EXPECT_TRUE(list.Empty());
+  EXPECT_EQ(list.Stats().frees, 300U);
+  list.Push_back(tracked);
+  EXPECT_EQ(list.Front(), tracked);
+  reclaimer.Drain();
+  EXPECT_EQ(reclaimer.Pending(), 0U);
+  EXPECT_EQ(tracked.use_count(), 2);
+}
+
+TEST(ListTest, Reclaimer_DestructorAndInheritance) {
+  s21::NodeReclaimer reclaimer;
+  auto tracked = std::make_shared<int>(0);
+  {
+    s21::ArenaList<std::shared_ptr<int>> list;
+    list.Set_reclaimer(&reclaimer);
+    for (int i = 0; i < 1000; ++i) list.Push_back(tracked);
+    s21::ArenaList<std::shared_ptr<int>> moved(std::move(list));
+    s21::ArenaList<std::shared_ptr<int>> copy(moved);
+    EXPECT_EQ(tracked.use_count(), 2001);
+  }
+  reclaimer.Drain();
+  EXPECT_EQ(tracked.use_count(), 1);
+
+  // Short lists are freed in place.
+  s21::ArenaList<int> small = {1, 2, 3};
+  small.Set_reclaimer(&reclaimer);
+  small.Clear();
+  EXPECT_EQ(reclaimer.Pending(), 0U);
+}
+
+// Records the thread that destroys the last of them.
+struct ThreadMarker {
+  static inline std::atomic<std::thread::id> freed_by{};
+  ~ThreadMarker() { freed_by = std::this_thread::get_id(); }
+};
+
+TEST(ListTest, Reclaimer_FollowsMoveAssignmentAndSwap) {
+  s21::NodeReclaimer reclaimer;
+  s21::ArenaList<ThreadMarker> source(1000);
+  source.Set_reclaimer(&reclaimer);
+  s21::ArenaList<ThreadMarker> assigned;
+  assigned = std::move(source);
+  assigned.Clear();
+  reclaimer.Drain();
+  EXPECT_NE(ThreadMarker::freed_by.load(), std::this_thread::get_id());
+
+  s21::ArenaList<ThreadMarker> first(1000);
+  first.Set_reclaimer(&reclaimer);
+  s21::ArenaList<ThreadMarker> second(1000);
+  first.Swap(second);
+  first.Clear();
+  EXPECT_EQ(ThreadMarker::freed_by.load(), std::this_thread::get_id());
+  second.Clear();
+  reclaimer.Drain();
+  EXPECT_NE(ThreadMarker::freed_by.load(), std::this_thread::get_id());
+}
+
+TEST(ListTest, Ranges_BidirectionalRange) {
+  static_assert(std::ranges::bidirectional_range<s21::List<int>>);
+  static_assert(std::ranges::bidirectional_range<const s21::List<int>>);
+  static_assert(std::ranges::sized_range<s21::List<int>>);
+
+  s21::List<int> list = {5, 1, 4, 2, 3};
+  auto it = list.End();
+  EXPECT_EQ(*--it, 3);
+  EXPECT_EQ(*std::ranges::prev(list.end(), 2), 2);
+  EXPECT_EQ(std::ranges::size(list), 5U);
+  EXPECT_EQ(*std::ranges::max_element(list), 5);
+  EXPECT_EQ(std::ranges::count_if(list, [](int v) { return v > 2; }), 3);
+
+  std::vector<int> reversed;
+  for (int v : list | std::views::reverse) reversed.push_back(v);
+  EXPECT_EQ(reversed, (std::vector<int>{3, 2, 4, 1, 5}));
+
+  std::ranges::replace(list, 4, 40);
+  const s21::List<int> &view = list;
+  std::vector<int> doubled;
+  for (int v : view | std::views::transform([](int v) { return v * 2; })) {
+    doubled.push_back(v);
+  }
+  EXPECT_EQ(doubled, (std::vector<int>{10, 2, 80, 4, 6}));
+
+  list.Pop_back();
+  EXPECT_EQ(*--list.end(), 2);
+  s21::List<int> empty;
+  auto e = empty.end();
+  EXPECT_EQ(--e, empty.end());
+}
+
+TEST(ListTest, Iterators_CompareMutableWithConst) {
+  s21::List<int> list = {1, 2};
+  s21::List<int>::iterator it = list.Begin();
+  s21::List<int>::const_iterator cit = list.Cbegin();
+  EXPECT_TRUE(it == cit);
+  EXPECT_TRUE(cit == it);
+  EXPECT_FALSE(it != cit);
+  EXPECT_FALSE(cit != it);
+  ++cit;
+  EXPECT_TRUE(it != cit);
+  EXPECT_TRUE(cit != it);
+  EXPECT_TRUE(list.Begin() != list.Cend());
+  EXPECT_TRUE(list.End() == list.Cend());
+  s21::List<int>::const_iterator converted = it;
+  EXPECT_EQ(converted, list.Cbegin());
+}
+
+template <typename L>
+static std::vector<int> to_vector(const L &list) {
+  return std::vector<int>(list.begin(), list.end());
+}
+
+TEST(ListTest, Split_RelinksTail) {
+  s21::List<int> list = {1, 2, 3, 4, 5};
+  auto it = std::ranges::next(list.Begin(), 2);
+  const int *third = &*it;
+  s21::List<int> tail = list.Split(it);
+  EXPECT_EQ(to_vector(list), (std::vector<int>{1, 2}));
+  EXPECT_EQ(to_vector(tail), (std::vector<int>{3, 4, 5}));
+  EXPECT_EQ(list.Size(), 2U);
+  EXPECT_EQ(tail.Size(), 3U);
+  EXPECT_EQ(&tail.Front(), third);
+  EXPECT_EQ(*--list.end(), 2);
+
+  s21::List<int> whole = tail.Split(tail.Begin(), 3);
+  EXPECT_TRUE(tail.Empty());
+  EXPECT_EQ(to_vector(whole), (std::vector<int>{3, 4, 5}));
+  EXPECT_TRUE(whole.Split(whole.End()).Empty());
+  whole.Push_back(6);
+  EXPECT_EQ(whole.Size(), 4U);
+
+  s21::ArenaList<int> reserved;
+  reserved.Reserve(8);
+  for (int i = 0; i < 8; ++i) reserved.Push_back(i);
+  s21::ArenaList<int> upper =
+      reserved.Split(std::ranges::next(reserved.Begin(), 4));
+  reserved.Clear();
+  upper.Pop_front();
+  EXPECT_EQ(to_vector(upper), (std::vector<int>{5, 6, 7}));
+}
+
+TEST(ListTest, Rotate_MovesEnds) {
+  s21::List<int> list = {1, 2, 3, 4, 5};
+  auto old_first = list.Rotate(std::ranges::next(list.Begin(), 3));
+  EXPECT_EQ(to_vector(list), (std::vector<int>{4, 5, 1, 2, 3}));
+  EXPECT_EQ(*old_first, 1);
+  EXPECT_EQ(*--list.end(), 3);
+  list.Rotate(list.Begin());
+  list.Rotate(list.End());
+  EXPECT_EQ(to_vector(list), (std::vector<int>{4, 5, 1, 2, 3}));
+  std::vector<int> backwards;
+  for (int v : list | std::views::reverse) backwards.push_back(v);
+  EXPECT_EQ(backwards, (std::vector<int>{3, 2, 1, 5, 4}));
+  s21::List<int> empty;
+  EXPECT_EQ(empty.Rotate(empty.Begin()), empty.End());
+}
+
+TEST(ListTest, Partition_KeepsOrderAndNodes) {
+  s21::List<int> list = {5, 2, 8, 1, 4, 7, 6};
+  std::vector<const int *> nodes;
+  for (const int &v : list) nodes.push_back(&v);
+  auto even = [](int v) { return v % 2 == 0; };
+  auto boundary = list.Stable_partition(even);
+  EXPECT_EQ(to_vector(list), (std::vector<int>{2, 8, 4, 6, 5, 1, 7}));
+  EXPECT_EQ(*boundary, 5);
+  EXPECT_EQ(&*boundary, nodes[0]);
+  EXPECT_EQ(list.Size(), 7U);
+  EXPECT_EQ(*--list.end(), 7);
+
+  EXPECT_EQ(list.Partition([](int) { return true; }), list.End());
+  EXPECT_EQ(list.Partition([](int) { return false; }), list.Begin());
+  s21::List<int> empty;
+  EXPECT_EQ(empty.Partition(even), empty.End());
+}
+
+TEST(ListTest, Partition_ThrowingPredicateKeepsElements) {
+  s21::List<int> list;
+  for (int i = 0; i < 100; ++i) list.Push_back(i);
+  int calls = 0;
+  auto pred = [&calls](int v) {
+    if (++calls == 50) throw std::runtime_error("predicate");
+    return v % 3 == 0;
+  };
+  EXPECT_THROW(list.Stable_partition(pred), std::runtime_error);
+  std::vector<int> values = to_vector(list);
+  EXPECT_EQ(values.size(), 100U);
+  std::ranges::sort(values);
+  for (int i = 0; i < 100; ++i) EXPECT_EQ(values[i], i);
+  EXPECT_EQ(list.Size(), 100U);
+}
+
+TEST(ListTest, Partition_ThreadedMatchesStdStablePartition) {
+  for (size_t threads : {2U, 4U}) {
+    // 8192 nodes per thread is twice the minimum chunk, so every thread
+    // gets one. The first chunk has no matches and the last one nothing
+    // else, so stitching has to cope with empty halves.
+    const int n = static_cast<int>(8192 * threads);
+    const int chunk = n / static_cast<int>(threads);
+    std::vector<int> values(n);
+    for (int i = 0; i < n; ++i) {
+      values[i] = i < chunk ? 2 * i + 1 : i >= n - chunk ? 2 * i : i * 7919 % n;
+    }
+    s21::List<int> list;
+    for (int v : values) list.Push_back(v);
+
+    std::mutex lock;
+    std::set<std::thread::id> callers;
+    auto even = [&](int v) {
+      std::lock_guard<std::mutex> guard(lock);
+      callers.insert(std::this_thread::get_id());
+      return v % 2 == 0;
+    };
+    auto boundary = list.Stable_partition(even, threads);
+    auto expected_boundary = std::stable_partition(
+        values.begin(), values.end(), [](int v) { return v % 2 == 0; });
+    EXPECT_EQ(callers.size(), threads);
+    EXPECT_EQ(to_vector(list), values);
+    EXPECT_EQ(std::ranges::distance(list.Begin(), boundary),
+              expected_boundary - values.begin());
+    EXPECT_EQ(list.Size(), values.size());
+    EXPECT_EQ(*--list.end(), values.back());
+
+    // A predicate failing in the last chunk, on a worker thread, reaches
+    // the caller and leaves every element in the list.
+    const int poison = values.back();
+    auto throwing = [poison](int v) {
+      if (v == poison) throw std::runtime_error("predicate");
+      return v % 3 == 0;
+    };
+    EXPECT_THROW(list.Stable_partition(throwing, threads), std::runtime_error);
+    std::vector<int> after = to_vector(list);
+    std::ranges::sort(after);
+    std::ranges::sort(values);
+    EXPECT_EQ(after, values);
+    EXPECT_EQ(list.Size(), values.size());
+  }
+}
+
+TEST(ListTest, Partition_ParallelMatchesSerial) {
+  s21::List<int> serial;
+  for (int i = 0; i < 50000; ++i) serial.Push_back((i * 7919) % 50000);
+  s21::List<int> parallel(serial);
+  auto pred = [](int v) { return v % 5 < 2; };
+  auto a = serial.Stable_partition(pred);
+  auto b = parallel.Partition(pred, 4);
+  EXPECT_EQ(to_vector(serial), to_vector(parallel));
+  EXPECT_EQ(*a, *b);
+  EXPECT_EQ(std::ranges::distance(parallel.Begin(), b), 20000);
+  EXPECT_EQ(*--parallel.end(), *--serial.end());
+
+  auto throwing = [](int v) {
+    if (v == 42) throw std::runtime_error("predicate");
+    return v % 2 == 0;
+  };
+  EXPECT_THROW(parallel.Stable_partition(throwing, 4), std::runtime_error);
+  std::vector<int> values = to_vector(parallel);
+  std::ranges::sort(values);
+  ASSERT_EQ(values.size(), 50000U);
+  for (int i = 0; i < 50000; ++i) ASSERT_EQ(values[i], i);
+}